@@ -0,0 +1,173 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../Common/bench.h"
+
+#include "../../Challenges/Challenge_1/challenge_1.h"
+
+#define TOTAL_WINDOW_SIZES 512
+#define MAX_WINDOW_RECORDS (1 << 22)
+
+static const char* level_names[] = {"scalar", "avx2", "avx512"};
+
+struct context
+{
+    uint64_t* array;
+    size_t length;
+
+    struct buffer series_16;
+    struct buffer series_32;
+
+    size_t window_sizes[TOTAL_WINDOW_SIZES];
+    uint64_t window_counts[TOTAL_WINDOW_SIZES];
+};
+
+static uint64_t run_count_increasing_pairs(void* context)
+{
+    struct context* c = context;
+    return count_increasing_pairs(c->array, c->length);
+}
+
+static uint64_t run_count_increasing_3_segment_windows(void* context)
+{
+    struct context* c = context;
+    return count_increasing_3_segment_windows(c->array, c->length);
+}
+
+static uint64_t run_count_series_pairs_16(void* context)
+{
+    struct context* c = context;
+    return count_series_pairs(&c->series_16);
+}
+
+static uint64_t run_count_series_pairs_32(void* context)
+{
+    struct context* c = context;
+    return count_series_pairs(&c->series_32);
+}
+
+static uint64_t run_count_series_3_segment_windows_16(void* context)
+{
+    struct context* c = context;
+    return count_series_3_segment_windows(&c->series_16);
+}
+
+static uint64_t run_count_series_3_segment_windows_32(void* context)
+{
+    struct context* c = context;
+    return count_series_3_segment_windows(&c->series_32);
+}
+
+static int fill_series(struct buffer* series, size_t width, const uint64_t* array, size_t length)
+{
+    buffer_init(series, width);
+    if (buffer_reserve(series, length) == -1) return -1;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        if (width == sizeof(uint16_t)) ((uint16_t*) series->data)[index] = (uint16_t) array[index];
+        else ((uint32_t*) series->data)[index] = (uint32_t) array[index];
+    }
+
+    series->length = length;
+
+    return 0;
+}
+
+static uint64_t run_count_increasing_windows(void* context)
+{
+    struct context* c = context;
+    count_increasing_windows(c->array, c->length, c->window_sizes, TOTAL_WINDOW_SIZES, c->window_counts);
+
+    uint64_t total = 0;
+
+    for (size_t index = 0; index < TOTAL_WINDOW_SIZES; ++index)
+    {
+        total += c->window_counts[index];
+    }
+
+    return total;
+}
+
+int main(int argc, char** argv)
+{
+    struct bench_options options;
+    bench_parse_options(argc, argv, &options);
+
+    size_t sizes[] = {1 << 10, 1 << 14, 1 << 18, 1 << 22, 1 << 24};
+
+    for (size_t size_index = 0; size_index < sizeof(sizes) / sizeof(size_t); ++size_index)
+    {
+        size_t length = sizes[size_index];
+        if (length > options.max_records) break;
+
+        uint64_t* array = malloc(length * sizeof(uint64_t));
+        if (array == NULL) return EXIT_FAILURE;
+
+        uint64_t state = 1;
+        uint64_t depth = 1 << 20;
+
+        for (size_t index = 0; index < length; ++index)
+        {
+            depth += bench_random_below(&state, 17);
+            depth -= 8;
+
+            array[index] = depth;
+        }
+
+        static struct context context;
+
+        context.array = array;
+        context.length = length;
+
+        for (size_t index = 0; index < TOTAL_WINDOW_SIZES; ++index)
+        {
+            context.window_sizes[index] = index + 1;
+        }
+
+        if (fill_series(&context.series_16, sizeof(uint16_t), array, length) == -1) return EXIT_FAILURE;
+        if (fill_series(&context.series_32, sizeof(uint32_t), array, length) == -1) return EXIT_FAILURE;
+
+        for (size_t level = count_level_scalar; level <= count_level_avx512; ++level)
+        {
+            if (count_select(level) != level) break;
+
+            char names[7][64];
+
+            snprintf(names[0], sizeof(names[0]), "count_increasing_pairs/%s", level_names[level]);
+            snprintf(names[1], sizeof(names[1]), "count_increasing_3_segment_windows/%s", level_names[level]);
+            snprintf(names[2], sizeof(names[2]), "count_series_pairs_u16/%s", level_names[level]);
+            snprintf(names[3], sizeof(names[3]), "count_series_3_segment_windows_u16/%s", level_names[level]);
+            snprintf(names[4], sizeof(names[4]), "count_series_pairs_u32/%s", level_names[level]);
+            snprintf(names[5], sizeof(names[5]), "count_series_3_segment_windows_u32/%s", level_names[level]);
+            snprintf(names[6], sizeof(names[6]), "count_increasing_windows_1_512/%s", level_names[level]);
+
+            struct bench benches[] =
+            {
+                {names[0], length, length * sizeof(uint64_t), NULL, run_count_increasing_pairs, &context},
+                {names[1], length, length * sizeof(uint64_t), NULL, run_count_increasing_3_segment_windows, &context},
+                {names[2], length, length * sizeof(uint16_t), NULL, run_count_series_pairs_16, &context},
+                {names[3], length, length * sizeof(uint16_t), NULL, run_count_series_3_segment_windows_16, &context},
+                {names[4], length, length * sizeof(uint32_t), NULL, run_count_series_pairs_32, &context},
+                {names[5], length, length * sizeof(uint32_t), NULL, run_count_series_3_segment_windows_32, &context},
+                {names[6], length, length * sizeof(uint64_t), NULL, run_count_increasing_windows, &context},
+            };
+
+            size_t total_benches = length <= MAX_WINDOW_RECORDS ? 7 : 6;
+
+            for (size_t index = 0; index < total_benches; ++index)
+            {
+                bench_run(&benches[index], &options);
+            }
+        }
+
+        buffer_free(&context.series_16);
+        buffer_free(&context.series_32);
+
+        free(array);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,172 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <unistd.h>
+
+#include "../Common/bench.h"
+
+#include "../../Challenges/Challenge_2/challenge_2.h"
+
+#define BENCH_STEPS 1024
+#define BENCH_SCRIPTS 1024
+
+static const char* level_names[] = {"scalar", "avx2", "avx512"};
+
+struct context
+{
+    struct movement* array;
+    size_t length;
+
+    size_t total_threads;
+
+    struct navigation_index navigation_index;
+    size_t steps[BENCH_STEPS];
+    struct navigation navigations[BENCH_STEPS];
+
+    struct fleet fleet;
+    struct navigation fleet_navigations[BENCH_SCRIPTS];
+};
+
+static uint64_t run_calculate_final_position(void* context)
+{
+    struct context* c = context;
+    struct position position = calculate_final_position(c->array, c->length);
+
+    return position.horizontal * position.depth;
+}
+
+static uint64_t run_calculate_final_position_with_aim(void* context)
+{
+    struct context* c = context;
+    struct position position = calculate_final_position_with_aim(c->array, c->length);
+
+    return position.horizontal * position.depth;
+}
+
+static uint64_t run_navigation_update_parallel(void* context)
+{
+    struct context* c = context;
+
+    struct navigation navigation;
+    memset(&navigation, 0, sizeof(struct navigation));
+
+    navigation_update_parallel(&navigation, c->array, c->length, c->total_threads);
+
+    return navigation.position_with_aim.horizontal * navigation.position_with_aim.depth;
+}
+
+static uint64_t run_navigation_index_query_batch(void* context)
+{
+    struct context* c = context;
+    navigation_index_query_batch(&c->navigation_index, c->steps, BENCH_STEPS, c->navigations);
+
+    return c->navigations[BENCH_STEPS - 1].position_with_aim.depth;
+}
+
+static uint64_t run_fleet_solve(void* context)
+{
+    struct context* c = context;
+    fleet_solve(&c->fleet, c->fleet_navigations);
+
+    return c->fleet_navigations[BENCH_SCRIPTS - 1].position_with_aim.depth;
+}
+
+int main(int argc, char** argv)
+{
+    struct bench_options options;
+    bench_parse_options(argc, argv, &options);
+
+    size_t sizes[] = {1 << 10, 1 << 14, 1 << 18, 1 << 22, 1 << 24};
+
+    for (size_t size_index = 0; size_index < sizeof(sizes) / sizeof(size_t); ++size_index)
+    {
+        size_t length = sizes[size_index];
+        if (length > options.max_records) break;
+
+        struct movement* array = malloc(length * sizeof(struct movement));
+        if (array == NULL) return EXIT_FAILURE;
+
+        uint64_t state = 2;
+
+        for (size_t index = 0; index < length; ++index)
+        {
+            enum direction direction = direction_forward + bench_random_below(&state, 3);
+            array[index] = movement_pack(direction, 1 + bench_random_below(&state, 9));
+        }
+
+        struct context context;
+        memset(&context, 0, sizeof(struct context));
+
+        context.array = array;
+        context.length = length;
+        context.total_threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+        if (navigation_index_build(&context.navigation_index, array, length, NAVIGATION_INTERVAL) == -1) return EXIT_FAILURE;
+
+        for (size_t index = 0; index < BENCH_STEPS; ++index)
+        {
+            context.steps[index] = bench_random_below(&state, length + 1);
+        }
+
+        const struct movement* arrays[BENCH_SCRIPTS];
+        size_t lengths[BENCH_SCRIPTS];
+
+        size_t total_steps = 0;
+
+        for (size_t index = 0; index < BENCH_SCRIPTS; ++index)
+        {
+            size_t begin = length * index / BENCH_SCRIPTS;
+            size_t end = length * (index + 1) / BENCH_SCRIPTS;
+
+            arrays[index] = array + begin;
+            lengths[index] = (end - begin) * (1 + index % 4) / 4;
+
+            total_steps += lengths[index];
+        }
+
+        if (fleet_build(&context.fleet, arrays, lengths, BENCH_SCRIPTS) == -1) return EXIT_FAILURE;
+
+        struct bench benches[] =
+        {
+            {"calculate_final_position", length, length * sizeof(struct movement), NULL, run_calculate_final_position, &context},
+            {"calculate_final_position_with_aim", length, length * sizeof(struct movement), NULL, run_calculate_final_position_with_aim, &context},
+            {"navigation_update_parallel", length, length * sizeof(struct movement), NULL, run_navigation_update_parallel, &context},
+            {"navigation_index_query_batch", BENCH_STEPS, BENCH_STEPS * sizeof(size_t), NULL, run_navigation_index_query_batch, &context},
+        };
+
+        for (size_t index = 0; index < sizeof(benches) / sizeof(struct bench); ++index)
+        {
+            bench_run(&benches[index], &options);
+        }
+
+        for (size_t level = navigation_level_scalar; level <= navigation_level_avx512; ++level)
+        {
+            if (navigation_select(level) != level) break;
+
+            char names[2][64];
+
+            snprintf(names[0], sizeof(names[0]), "calculate_final_position_with_aim/%s", level_names[level]);
+            snprintf(names[1], sizeof(names[1]), "fleet_solve/%s", level_names[level]);
+
+            struct bench level_benches[] =
+            {
+                {names[0], length, length * sizeof(struct movement), NULL, run_calculate_final_position_with_aim, &context},
+                {names[1], total_steps, total_steps * sizeof(struct movement), NULL, run_fleet_solve, &context},
+            };
+
+            for (size_t index = 0; index < sizeof(level_benches) / sizeof(struct bench); ++index)
+            {
+                bench_run(&level_benches[index], &options);
+            }
+        }
+
+        navigation_index_free(&context.navigation_index);
+        fleet_free(&context.fleet);
+        free(array);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,290 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <unistd.h>
+
+#include "../Common/bench.h"
+
+#include "../../Challenges/Challenge_3/challenge_3.h"
+
+static const char* level_names[] = {"scalar", "avx2", "avx512"};
+
+struct context
+{
+    uint64_t* array;
+    const uint64_t* source;
+    size_t length;
+
+    uint64_t* column_counts;
+    size_t total_columns;
+
+    size_t total_threads;
+
+    struct rating_index rating_index;
+};
+
+struct wide_context
+{
+    uint64_t* rows;
+    size_t length;
+    size_t row_words;
+
+    uint64_t* column_counts;
+    size_t total_columns;
+
+    size_t total_threads;
+
+    struct bit_matrix matrix;
+};
+
+static void prepare_count_ones_in_columns(void* context)
+{
+    struct context* c = context;
+    memset(c->column_counts, 0, c->total_columns * sizeof(uint64_t));
+}
+
+static uint64_t run_count_ones_in_columns(void* context)
+{
+    struct context* c = context;
+    count_ones_in_columns(c->array, c->length, 0, c->column_counts, c->total_columns);
+
+    return c->column_counts[0];
+}
+
+static uint64_t run_count_ones_in_columns_parallel(void* context)
+{
+    struct context* c = context;
+    count_ones_in_columns_parallel(c->array, c->length, 0, c->column_counts, c->total_columns, c->total_threads);
+
+    return c->column_counts[0];
+}
+
+static void prepare_rows(void* context)
+{
+    struct context* c = context;
+    memcpy(c->array, c->source, c->length * sizeof(uint64_t));
+}
+
+static uint64_t run_calculate_rating_most_common(void* context)
+{
+    struct context* c = context;
+    return calculate_rating(c->array, c->length, c->total_columns, mode_most_common);
+}
+
+static uint64_t run_calculate_rating_least_common(void* context)
+{
+    struct context* c = context;
+    return calculate_rating(c->array, c->length, c->total_columns, mode_least_common);
+}
+
+static uint64_t run_rating_index_build(void* context)
+{
+    struct context* c = context;
+
+    struct rating_index rating_index;
+    rating_index_build(&rating_index, c->array, c->length, c->total_columns);
+
+    size_t length = rating_index.total_rows;
+    rating_index_free(&rating_index);
+
+    return length;
+}
+
+static uint64_t run_rating_index_find(void* context)
+{
+    struct context* c = context;
+
+    uint64_t oxygen = 0;
+    uint64_t carbon = 0;
+
+    rating_index_find(&c->rating_index, mode_most_common, &oxygen);
+    rating_index_find(&c->rating_index, mode_least_common, &carbon);
+
+    return oxygen * carbon;
+}
+
+static uint64_t run_bit_matrix_build(void* context)
+{
+    struct wide_context* c = context;
+
+    struct bit_matrix matrix;
+    bit_matrix_build(&matrix, c->rows, c->length, c->row_words, c->total_columns, c->total_threads);
+
+    size_t length = matrix.words.length;
+    bit_matrix_free(&matrix);
+
+    return length;
+}
+
+static uint64_t run_bit_matrix_count(void* context)
+{
+    struct wide_context* c = context;
+    bit_matrix_count(&c->matrix, c->column_counts, c->total_threads);
+
+    return c->column_counts[0];
+}
+
+static uint64_t run_bit_matrix_find(void* context)
+{
+    struct wide_context* c = context;
+
+    size_t oxygen = 0;
+    size_t carbon = 0;
+
+    bit_matrix_find(&c->matrix, mode_most_common, &oxygen);
+    bit_matrix_find(&c->matrix, mode_least_common, &carbon);
+
+    return oxygen + carbon;
+}
+
+static int run_wide(const struct bench_options* options)
+{
+    size_t sizes[] = {1 << 10, 1 << 14, 1 << 17};
+    size_t widths[] = {256, 4096};
+
+    for (size_t size_index = 0; size_index < sizeof(sizes) / sizeof(size_t); ++size_index)
+    {
+        size_t length = sizes[size_index];
+        if (length > options->max_records) break;
+
+        for (size_t width_index = 0; width_index < sizeof(widths) / sizeof(size_t); ++width_index)
+        {
+            size_t total_columns = widths[width_index];
+            size_t row_words = total_columns / 64;
+
+            uint64_t* rows = malloc(length * row_words * sizeof(uint64_t));
+            uint64_t* column_counts = malloc(total_columns * sizeof(uint64_t));
+
+            if (rows == NULL || column_counts == NULL) return -1;
+
+            uint64_t state = 3;
+            for (size_t index = 0; index < length * row_words; ++index) rows[index] = bench_random(&state);
+
+            struct wide_context context =
+            {
+                .rows = rows,
+                .length = length,
+                .row_words = row_words,
+                .column_counts = column_counts,
+                .total_columns = total_columns,
+                .total_threads = sysconf(_SC_NPROCESSORS_ONLN),
+            };
+            if (bit_matrix_build(&context.matrix, rows, length, row_words, total_columns, context.total_threads) == -1) return -1;
+
+            char names[3][64];
+
+            snprintf(names[0], sizeof(names[0]), "bit_matrix_build/%zu", total_columns);
+            snprintf(names[1], sizeof(names[1]), "bit_matrix_count/%zu", total_columns);
+            snprintf(names[2], sizeof(names[2]), "bit_matrix_find/%zu", total_columns);
+
+            size_t bytes = length * row_words * sizeof(uint64_t);
+
+            struct bench benches[] =
+            {
+                {names[0], length, bytes, NULL, run_bit_matrix_build, &context},
+                {names[1], length, bytes, NULL, run_bit_matrix_count, &context},
+                {names[2], length, bytes, NULL, run_bit_matrix_find, &context},
+            };
+
+            for (size_t index = 0; index < sizeof(benches) / sizeof(struct bench); ++index)
+            {
+                bench_run(&benches[index], options);
+            }
+
+            bit_matrix_free(&context.matrix);
+
+            free(rows);
+            free(column_counts);
+        }
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    struct bench_options options;
+    bench_parse_options(argc, argv, &options);
+
+    size_t sizes[] = {1 << 10, 1 << 14, 1 << 18, 1 << 22};
+    size_t widths[] = {12, 64};
+
+    uint64_t column_counts[64];
+
+    for (size_t size_index = 0; size_index < sizeof(sizes) / sizeof(size_t); ++size_index)
+    {
+        size_t length = sizes[size_index];
+        if (length > options.max_records) break;
+
+        uint64_t* array = malloc(length * sizeof(uint64_t));
+        uint64_t* source = malloc(length * sizeof(uint64_t));
+
+        if (array == NULL || source == NULL) return EXIT_FAILURE;
+
+        for (size_t width_index = 0; width_index < sizeof(widths) / sizeof(size_t); ++width_index)
+        {
+            size_t total_columns = widths[width_index];
+            uint64_t mask = total_columns < 64 ? ((uint64_t) 1 << total_columns) - 1 : (uint64_t) -1;
+
+            uint64_t state = 3;
+            for (size_t index = 0; index < length; ++index) source[index] = bench_random(&state) & mask;
+            memcpy(array, source, length * sizeof(uint64_t));
+
+            struct context context =
+            {
+                .array = array,
+                .source = source,
+                .length = length,
+                .column_counts = column_counts,
+                .total_columns = total_columns,
+                .total_threads = sysconf(_SC_NPROCESSORS_ONLN),
+            };
+            if (rating_index_build(&context.rating_index, array, length, total_columns) == -1) return EXIT_FAILURE;
+
+            for (size_t level = column_level_scalar; level <= column_level_avx512; ++level)
+            {
+                if (column_select(level) != level) break;
+
+                char name[64];
+                snprintf(name, sizeof(name), "count_ones_in_columns/%zu/%s", total_columns, level_names[level]);
+
+                struct bench bench = {name, length, length * sizeof(uint64_t), prepare_count_ones_in_columns, run_count_ones_in_columns, &context};
+                bench_run(&bench, &options);
+            }
+
+            char names[5][64];
+
+            snprintf(names[0], sizeof(names[0]), "count_ones_in_columns_parallel/%zu", total_columns);
+            snprintf(names[1], sizeof(names[1]), "calculate_rating/most/%zu", total_columns);
+            snprintf(names[2], sizeof(names[2]), "calculate_rating/least/%zu", total_columns);
+            snprintf(names[3], sizeof(names[3]), "rating_index_build/%zu", total_columns);
+            snprintf(names[4], sizeof(names[4]), "rating_index_find/%zu", total_columns);
+
+            struct bench benches[] =
+            {
+                {names[0], length, length * sizeof(uint64_t), prepare_count_ones_in_columns, run_count_ones_in_columns_parallel, &context},
+                {names[1], length, length * sizeof(uint64_t), prepare_rows, run_calculate_rating_most_common, &context},
+                {names[2], length, length * sizeof(uint64_t), prepare_rows, run_calculate_rating_least_common, &context},
+                {names[3], length, length * sizeof(uint64_t), prepare_rows, run_rating_index_build, &context},
+                {names[4], length, length * sizeof(uint64_t), NULL, run_rating_index_find, &context},
+            };
+
+            for (size_t index = 0; index < sizeof(benches) / sizeof(struct bench); ++index)
+            {
+                bench_run(&benches[index], &options);
+            }
+
+            rating_index_free(&context.rating_index);
+        }
+
+        free(array);
+        free(source);
+    }
+
+    if (run_wide(&options) == -1) return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../Common/bench.h"
+
+#include "../../Challenges/Challenge_4/challenge_4.h"
+
+#define WIDTH 5
+#define HEIGHT 5
+#define NUMBERS 100
+
+struct context
+{
+    const uint64_t* array;
+    size_t length;
+
+    const uint64_t* original_board_numbers;
+    uint64_t* board_numbers;
+    size_t total_boards;
+
+    size_t* winners;
+};
+
+static void prepare_bingo_game(void* context)
+{
+    struct context* c = context;
+    memcpy(c->board_numbers, c->original_board_numbers, c->total_boards * WIDTH * HEIGHT * sizeof(uint64_t));
+}
+
+static uint64_t run_bingo_game(void* context)
+{
+    struct context* c = context;
+
+    size_t total_winners = 0;
+    size_t index = bingo_game(c->array, c->length, c->board_numbers, WIDTH, HEIGHT, c->total_boards, c->winners, &total_winners);
+
+    return index + total_winners;
+}
+
+int main(int argc, char** argv)
+{
+    struct bench_options options;
+    bench_parse_options(argc, argv, &options);
+
+    size_t sizes[] = {1 << 6, 1 << 10, 1 << 14, 1 << 18};
+
+    uint64_t array[NUMBERS];
+    uint64_t state = 4;
+
+    for (size_t index = 0; index < NUMBERS; ++index) array[index] = index;
+
+    for (size_t index = NUMBERS - 1; index > 0; --index)
+    {
+        size_t other = bench_random_below(&state, index + 1);
+
+        uint64_t temp = array[index];
+        array[index] = array[other];
+        array[other] = temp;
+    }
+
+    for (size_t size_index = 0; size_index < sizeof(sizes) / sizeof(size_t); ++size_index)
+    {
+        size_t total_boards = sizes[size_index];
+        if (total_boards > options.max_records) break;
+
+        size_t board_numbers_length = total_boards * WIDTH * HEIGHT;
+
+        uint64_t* original_board_numbers = malloc(board_numbers_length * sizeof(uint64_t));
+        uint64_t* board_numbers = malloc(board_numbers_length * sizeof(uint64_t));
+        size_t* winners = malloc(total_boards * sizeof(size_t));
+
+        if (original_board_numbers == NULL || board_numbers == NULL || winners == NULL) return EXIT_FAILURE;
+
+        for (size_t board_index = 0; board_index < total_boards; ++board_index)
+        {
+            uint64_t numbers[NUMBERS];
+            for (size_t index = 0; index < NUMBERS; ++index) numbers[index] = index;
+
+            for (size_t index = 0; index < WIDTH * HEIGHT; ++index)
+            {
+                size_t other = index + bench_random_below(&state, NUMBERS - index);
+
+                uint64_t temp = numbers[index];
+                numbers[index] = numbers[other];
+                numbers[other] = temp;
+
+                original_board_numbers[board_index * WIDTH * HEIGHT + index] = numbers[index];
+            }
+        }
+
+        struct context context = {array, NUMBERS, original_board_numbers, board_numbers, total_boards, winners};
+
+        struct bench bench = {"bingo_game", total_boards, board_numbers_length * sizeof(uint64_t), prepare_bingo_game, run_bingo_game, &context};
+        bench_run(&bench, &options);
+
+        free(original_board_numbers);
+        free(board_numbers);
+        free(winners);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../Common/bench.h"
+
+#include "../../Challenges/Challenge_5/challenge_5.h"
+
+#define CANVAS_WIDTH 1000
+#define CANVAS_HEIGHT 1000
+
+struct context
+{
+    const struct line* array;
+    size_t length;
+
+    uint64_t* canvas;
+    uint64_t* other_canvas;
+    size_t canvas_mem_bytes;
+};
+
+static void prepare_draw_one_line(void* context)
+{
+    struct context* c = context;
+
+    memset(c->canvas, 0, c->canvas_mem_bytes);
+    memset(c->other_canvas, 0, c->canvas_mem_bytes);
+}
+
+static uint64_t run_draw_one_line(void* context)
+{
+    struct context* c = context;
+    uint64_t count = 0;
+
+    for (size_t index = 0; index < c->length; ++index)
+    {
+        count += draw_one_line(c->canvas, c->other_canvas, CANVAS_WIDTH, CANVAS_HEIGHT, &c->array[index]);
+    }
+
+    return count;
+}
+
+int main(int argc, char** argv)
+{
+    struct bench_options options;
+    bench_parse_options(argc, argv, &options);
+
+    size_t sizes[] = {1 << 6, 1 << 10, 1 << 14};
+
+    size_t word_size = sizeof(uint64_t) * CHAR_BIT;
+    size_t canvas_mem_bytes = ceil_up(CANVAS_WIDTH * CANVAS_HEIGHT, word_size) / CHAR_BIT;
+
+    uint64_t* canvas = malloc(canvas_mem_bytes);
+    uint64_t* other_canvas = malloc(canvas_mem_bytes);
+
+    if (canvas == NULL || other_canvas == NULL) return EXIT_FAILURE;
+
+    for (size_t size_index = 0; size_index < sizeof(sizes) / sizeof(size_t); ++size_index)
+    {
+        size_t length = sizes[size_index];
+        if (length > options.max_records) break;
+
+        struct line* array = malloc(length * sizeof(struct line));
+        if (array == NULL) return EXIT_FAILURE;
+
+        uint64_t state = 5;
+
+        for (size_t index = 0; index < length; ++index)
+        {
+            double x1 = bench_random_below(&state, CANVAS_WIDTH);
+            double y1 = bench_random_below(&state, CANVAS_HEIGHT);
+
+            double x2 = x1;
+            double y2 = y1;
+
+            switch (bench_random_below(&state, 3))
+            {
+                case 0: x2 = bench_random_below(&state, CANVAS_WIDTH); break;
+                case 1: y2 = bench_random_below(&state, CANVAS_HEIGHT); break;
+                case 2:
+                {
+                    double size = bench_random_below(&state, CANVAS_WIDTH);
+
+                    if (x1 + size >= CANVAS_WIDTH) size = CANVAS_WIDTH - 1 - x1;
+                    if (y1 + size >= CANVAS_HEIGHT) size = CANVAS_HEIGHT - 1 - y1;
+
+                    x2 = x1 + size;
+                    y2 = y1 + size;
+
+                    break;
+                }
+            }
+
+            struct line line = {{x1, y1}, {x2, y2}};
+            array[index] = line;
+        }
+
+        struct context context = {array, length, canvas, other_canvas, canvas_mem_bytes};
+
+        struct bench bench = {"draw_one_line", length, length * sizeof(struct line), prepare_draw_one_line, run_draw_one_line, &context};
+        bench_run(&bench, &options);
+
+        free(array);
+    }
+
+    free(canvas);
+    free(other_canvas);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "bench.h"
+
+static volatile uint64_t bench_sink;
+
+static double bench_now(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (double) time.tv_sec * 1e9 + (double) time.tv_nsec;
+}
+
+void bench_parse_options(int argc, char** argv, struct bench_options* options)
+{
+    options->repetitions = BENCH_DEFAULT_REPETITIONS;
+    options->max_records = SIZE_MAX;
+
+    if (argc > 1) options->repetitions = strtoull(argv[1], NULL, 10);
+    if (argc > 2) options->max_records = strtoull(argv[2], NULL, 10);
+
+    if (options->repetitions < 2) options->repetitions = 2;
+}
+
+void bench_run(const struct bench* bench, const struct bench_options* options)
+{
+    if (bench->records > options->max_records) return;
+
+    size_t repetitions = options->repetitions;
+
+    double sum = 0;
+    double sum_squares = 0;
+    double minimum = INFINITY;
+
+    if (bench->prepare != NULL) bench->prepare(bench->context);
+    bench_sink += bench->run(bench->context);
+
+    for (size_t repetition = 0; repetition < repetitions; ++repetition)
+    {
+        if (bench->prepare != NULL) bench->prepare(bench->context);
+
+        double start = bench_now();
+        bench_sink += bench->run(bench->context);
+        double elapsed = bench_now() - start;
+
+        sum += elapsed;
+        sum_squares += elapsed * elapsed;
+
+        if (elapsed < minimum) minimum = elapsed;
+    }
+
+    double mean = sum / repetitions;
+    double variance = (sum_squares - sum * mean) / (repetitions - 1);
+    if (variance < 0) variance = 0;
+
+    double deviation = sqrt(variance);
+    double records = bench->records != 0 ? (double) bench->records : 1;
+
+    printf("%-36s %10zu records %10.3f ns/record (min %10.3f) +- %6.2f%% %10.1f MB/s\n",
+        bench->name,
+        bench->records,
+        mean / records,
+        minimum / records,
+        100 * deviation / mean,
+        (double) bench->bytes / mean * 1e3);
+}
+
+uint64_t bench_random(uint64_t* state)
+{
+    uint64_t value = (*state += 0x9E3779B97F4A7C15);
+
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+
+    return value ^ (value >> 31);
+}
+
+uint64_t bench_random_below(uint64_t* state, uint64_t bound)
+{
+    return (uint64_t) (((unsigned __int128) bench_random(state) * bound) >> 64);
+}
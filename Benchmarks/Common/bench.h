@@ -0,0 +1,34 @@
+#ifndef BENCHMARKS_BENCH_H
+#define BENCHMARKS_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_DEFAULT_REPETITIONS 20
+
+struct bench
+{
+    const char* name;
+
+    size_t records;
+    size_t bytes;
+
+    void (*prepare)(void* context);
+    uint64_t (*run)(void* context);
+
+    void* context;
+};
+
+struct bench_options
+{
+    size_t repetitions;
+    size_t max_records;
+};
+
+void bench_parse_options(int argc, char** argv, struct bench_options* options);
+void bench_run(const struct bench* bench, const struct bench_options* options);
+
+uint64_t bench_random(uint64_t* state);
+uint64_t bench_random_below(uint64_t* state, uint64_t bound);
+
+#endif
@@ -0,0 +1,888 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define COUNT_X86 1
+#else
+#define COUNT_X86 0
+#endif
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/scan.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+#include "challenge_1.h"
+
+#define WINDOW_TILE 4096
+
+struct count_functions
+{
+    uint64_t (*shifted)(const uint64_t* array, size_t length, size_t distance);
+    uint64_t (*windows)(const uint64_t* array, size_t length);
+
+    uint64_t (*shifted_16)(const uint16_t* array, size_t length, size_t distance);
+    uint64_t (*shifted_32)(const uint32_t* array, size_t length, size_t distance);
+};
+
+struct count_range
+{
+    pthread_t thread;
+    int started;
+
+    const char* str;
+    const char* last;
+
+    struct increasing_counter counter;
+};
+
+static inline size_t series_width(uint64_t value)
+{
+    if (value <= UINT16_MAX) return sizeof(uint16_t);
+    if (value <= UINT32_MAX) return sizeof(uint32_t);
+
+    return sizeof(uint64_t);
+}
+
+static inline uint64_t series_load(const void* data, size_t width, size_t index)
+{
+    switch (width)
+    {
+        case sizeof(uint16_t): return ((const uint16_t*) data)[index];
+        case sizeof(uint32_t): return ((const uint32_t*) data)[index];
+        default: return ((const uint64_t*) data)[index];
+    }
+}
+
+static inline void series_store(void* data, size_t width, size_t index, uint64_t value)
+{
+    switch (width)
+    {
+        case sizeof(uint16_t): ((uint16_t*) data)[index] = (uint16_t) value; break;
+        case sizeof(uint32_t): ((uint32_t*) data)[index] = (uint32_t) value; break;
+        default: ((uint64_t*) data)[index] = value; break;
+    }
+}
+
+static void series_reset(struct buffer* array)
+{
+    array->capacity = array->capacity * array->element_size / sizeof(uint16_t);
+    array->element_size = sizeof(uint16_t);
+    array->length = 0;
+}
+
+static inline int series_push(struct buffer* array, uint64_t value)
+{
+    if (series_width(value) > array->element_size && challenge_1_widen(array, series_width(value)) == -1) return -1;
+
+    if (buffer_push(array) == NULL) return -1;
+    series_store(array->data, array->element_size, array->length - 1, value);
+
+    return 0;
+}
+
+uint64_t challenge_1_value(const struct buffer* array, size_t index)
+{
+    return series_load(array->data, array->element_size, index);
+}
+
+int challenge_1_widen(struct buffer* array, size_t width)
+{
+    size_t old_width = array->element_size;
+    size_t old_capacity = array->capacity;
+
+    if (width <= old_width) return 0;
+
+    array->element_size = width;
+    array->capacity = 0;
+
+    if (old_capacity != 0 && buffer_reserve(array, old_capacity) == -1)
+    {
+        array->element_size = old_width;
+        array->capacity = old_capacity;
+
+        return -1;
+    }
+
+    for (size_t index = array->length; index-- > 0;)
+    {
+        series_store(array->data, width, index, series_load(array->data, old_width, index));
+    }
+
+    return 0;
+}
+
+int challenge_1_read(const char* str, const char* last, struct buffer* array)
+{
+    while (str != last)
+    {
+        const char* end;
+
+        end = last;
+        scan_non_digit(str, &end);
+
+        str = end;
+        
+        end = last;
+        uint64_t value = scan_decimal(str, &end);
+        
+        if (str != end && series_push(array, value) == -1) return -1;
+        
+        str = end;
+    }
+    
+    return 0;
+}
+
+static int read_input(const struct input* input, struct buffer* array)
+{
+    return challenge_1_read(input->begin, input->end, array);
+}
+
+static uint64_t shifted_scalar(const uint64_t* array, size_t length, size_t distance)
+{
+    uint64_t count = 0;
+
+    for (size_t index = 0; index + distance < length; ++index)
+    {
+        if (array[index + distance] > array[index]) count += 1;
+    }
+
+    return count;
+}
+
+static uint64_t shifted_scalar_16(const uint16_t* array, size_t length, size_t distance)
+{
+    uint64_t count = 0;
+
+    for (size_t index = 0; index + distance < length; ++index)
+    {
+        if (array[index + distance] > array[index]) count += 1;
+    }
+
+    return count;
+}
+
+static uint64_t shifted_scalar_32(const uint32_t* array, size_t length, size_t distance)
+{
+    uint64_t count = 0;
+
+    for (size_t index = 0; index + distance < length; ++index)
+    {
+        if (array[index + distance] > array[index]) count += 1;
+    }
+
+    return count;
+}
+
+static uint64_t windows_scalar(const uint64_t* array, size_t length)
+{
+    if (length < 3) return 0;
+
+    uint64_t count = 0;
+
+    uint64_t previous_1 = array[0];
+    uint64_t previous_2 = array[1];
+    uint64_t previous_3 = array[2];
+
+    uint64_t previous_sum = previous_1 + previous_2 + previous_3;
+
+    for (uint64_t index = 3; index < length; ++index)
+    {
+        uint64_t sum = previous_2 + previous_3 + array[index];
+        if (sum > previous_sum) count += 1;
+
+        previous_1 = previous_2;
+        previous_2 = previous_3;
+        previous_3 = array[index];
+        
+        previous_sum = sum;
+    }
+    
+    return count;
+}
+
+static uint64_t shifted_tail(const uint64_t* array, size_t length, size_t distance, size_t index)
+{
+    uint64_t count = 0;
+
+    for (; index + distance < length; ++index)
+    {
+        if (array[index + distance] > array[index]) count += 1;
+    }
+
+    return count;
+}
+
+static uint64_t windows_tail(const uint64_t* array, size_t length, size_t index)
+{
+    uint64_t count = 0;
+
+    for (; index + 3 < length; ++index)
+    {
+        uint64_t middle = array[index + 1] + array[index + 2];
+        if (middle + array[index + 3] > array[index] + middle) count += 1;
+    }
+
+    return count;
+}
+
+#if COUNT_X86
+
+__attribute__((target("avx2,popcnt")))
+static uint64_t shifted_avx2(const uint64_t* array, size_t length, size_t distance)
+{
+    __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+
+    uint64_t count = 0;
+    size_t index = 0;
+
+    for (; index + distance + 4 <= length; index += 4)
+    {
+        __m256i previous = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) &array[index]), sign);
+        __m256i current = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) &array[index + distance]), sign);
+
+        __m256i greater = _mm256_cmpgt_epi64(current, previous);
+        count += __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(greater)));
+    }
+
+    return count + shifted_tail(array, length, distance, index);
+}
+
+__attribute__((target("avx2,popcnt")))
+static uint64_t shifted_avx2_16(const uint16_t* array, size_t length, size_t distance)
+{
+    __m256i sign = _mm256_set1_epi16(INT16_MIN);
+
+    uint64_t count = 0;
+    size_t index = 0;
+
+    for (; index + distance + 16 <= length; index += 16)
+    {
+        __m256i previous = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) &array[index]), sign);
+        __m256i current = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) &array[index + distance]), sign);
+
+        __m256i greater = _mm256_cmpgt_epi16(current, previous);
+        count += __builtin_popcount(_mm256_movemask_epi8(greater)) / 2;
+    }
+
+    return count + shifted_scalar_16(array + index, length - index, distance);
+}
+
+__attribute__((target("avx2,popcnt")))
+static uint64_t shifted_avx2_32(const uint32_t* array, size_t length, size_t distance)
+{
+    __m256i sign = _mm256_set1_epi32(INT32_MIN);
+
+    uint64_t count = 0;
+    size_t index = 0;
+
+    for (; index + distance + 8 <= length; index += 8)
+    {
+        __m256i previous = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) &array[index]), sign);
+        __m256i current = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) &array[index + distance]), sign);
+
+        __m256i greater = _mm256_cmpgt_epi32(current, previous);
+        count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(greater)));
+    }
+
+    return count + shifted_scalar_32(array + index, length - index, distance);
+}
+
+__attribute__((target("avx2,popcnt")))
+static uint64_t windows_avx2(const uint64_t* array, size_t length)
+{
+    __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+
+    uint64_t count = 0;
+    size_t index = 0;
+
+    for (; index + 7 <= length; index += 4)
+    {
+        __m256i first = _mm256_loadu_si256((const __m256i*) &array[index]);
+        __m256i second = _mm256_loadu_si256((const __m256i*) &array[index + 1]);
+        __m256i third = _mm256_loadu_si256((const __m256i*) &array[index + 2]);
+        __m256i fourth = _mm256_loadu_si256((const __m256i*) &array[index + 3]);
+
+        __m256i middle = _mm256_add_epi64(second, third);
+
+        __m256i previous = _mm256_xor_si256(_mm256_add_epi64(first, middle), sign);
+        __m256i current = _mm256_xor_si256(_mm256_add_epi64(middle, fourth), sign);
+
+        __m256i greater = _mm256_cmpgt_epi64(current, previous);
+        count += __builtin_popcount(_mm256_movemask_pd(_mm256_castsi256_pd(greater)));
+    }
+
+    return count + windows_tail(array, length, index);
+}
+
+__attribute__((target("avx512f,popcnt")))
+static uint64_t shifted_avx512(const uint64_t* array, size_t length, size_t distance)
+{
+    uint64_t count = 0;
+    size_t index = 0;
+
+    for (; index + distance + 8 <= length; index += 8)
+    {
+        __m512i previous = _mm512_loadu_si512(&array[index]);
+        __m512i current = _mm512_loadu_si512(&array[index + distance]);
+
+        count += __builtin_popcount(_mm512_cmpgt_epu64_mask(current, previous));
+    }
+
+    return count + shifted_tail(array, length, distance, index);
+}
+
+__attribute__((target("avx512f,avx512bw,popcnt")))
+static uint64_t shifted_avx512_16(const uint16_t* array, size_t length, size_t distance)
+{
+    uint64_t count = 0;
+    size_t index = 0;
+
+    for (; index + distance + 32 <= length; index += 32)
+    {
+        __m512i previous = _mm512_loadu_si512(&array[index]);
+        __m512i current = _mm512_loadu_si512(&array[index + distance]);
+
+        count += __builtin_popcount(_mm512_cmpgt_epu16_mask(current, previous));
+    }
+
+    return count + shifted_scalar_16(array + index, length - index, distance);
+}
+
+__attribute__((target("avx512f,popcnt")))
+static uint64_t shifted_avx512_32(const uint32_t* array, size_t length, size_t distance)
+{
+    uint64_t count = 0;
+    size_t index = 0;
+
+    for (; index + distance + 16 <= length; index += 16)
+    {
+        __m512i previous = _mm512_loadu_si512(&array[index]);
+        __m512i current = _mm512_loadu_si512(&array[index + distance]);
+
+        count += __builtin_popcount(_mm512_cmpgt_epu32_mask(current, previous));
+    }
+
+    return count + shifted_scalar_32(array + index, length - index, distance);
+}
+
+__attribute__((target("avx512f,popcnt")))
+static uint64_t windows_avx512(const uint64_t* array, size_t length)
+{
+    uint64_t count = 0;
+    size_t index = 0;
+
+    for (; index + 11 <= length; index += 8)
+    {
+        __m512i first = _mm512_loadu_si512(&array[index]);
+        __m512i second = _mm512_loadu_si512(&array[index + 1]);
+        __m512i third = _mm512_loadu_si512(&array[index + 2]);
+        __m512i fourth = _mm512_loadu_si512(&array[index + 3]);
+
+        __m512i middle = _mm512_add_epi64(second, third);
+
+        __m512i previous = _mm512_add_epi64(first, middle);
+        __m512i current = _mm512_add_epi64(middle, fourth);
+
+        count += __builtin_popcount(_mm512_cmpgt_epu64_mask(current, previous));
+    }
+
+    return count + windows_tail(array, length, index);
+}
+
+#endif
+
+static const struct count_functions count_levels[] =
+{
+    [count_level_scalar] = {shifted_scalar, windows_scalar, shifted_scalar_16, shifted_scalar_32},
+#if COUNT_X86
+    [count_level_avx2] = {shifted_avx2, windows_avx2, shifted_avx2_16, shifted_avx2_32},
+    [count_level_avx512] = {shifted_avx512, windows_avx512, shifted_avx512_16, shifted_avx512_32},
+#endif
+};
+
+static const struct count_functions* count_selected = NULL;
+static pthread_once_t count_once = PTHREAD_ONCE_INIT;
+
+static enum count_level count_supported(void)
+{
+#if COUNT_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("popcnt")) return count_level_avx512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) return count_level_avx2;
+#endif
+
+    return count_level_scalar;
+}
+
+enum count_level count_select(enum count_level level)
+{
+    enum count_level supported = count_supported();
+    if (level > supported) level = supported;
+
+    count_selected = &count_levels[level];
+
+    return level;
+}
+
+static void count_default(void)
+{
+    if (count_selected == NULL) count_select(count_level_avx512);
+}
+
+static const struct count_functions* count_functions(void)
+{
+    pthread_once(&count_once, count_default);
+    return count_selected;
+}
+
+uint64_t count_increasing_pairs(const uint64_t* array, size_t length)
+{
+    return count_functions()->shifted(array, length, 1);
+}
+
+uint64_t count_increasing_3_segment_windows(const uint64_t* array, size_t length)
+{
+    return count_functions()->windows(array, length);
+}
+
+static uint64_t count_width_shifted(const struct count_functions* functions, const void* data, size_t width, size_t length, size_t distance)
+{
+    switch (width)
+    {
+        case sizeof(uint16_t): return functions->shifted_16(data, length, distance);
+        case sizeof(uint32_t): return functions->shifted_32(data, length, distance);
+        default: return functions->shifted(data, length, distance);
+    }
+}
+
+static uint64_t count_series_shifted(const struct buffer* array, size_t distance)
+{
+    return count_width_shifted(count_functions(), array->data, array->element_size, array->length, distance);
+}
+
+uint64_t count_series_pairs(const struct buffer* array)
+{
+    return count_series_shifted(array, 1);
+}
+
+uint64_t count_series_3_segment_windows(const struct buffer* array)
+{
+    if (array->element_size == sizeof(uint64_t)) return count_increasing_3_segment_windows(array->data, array->length);
+    return count_series_shifted(array, 3);
+}
+
+static int count_windows_wrapping(const uint64_t* array, size_t length, const size_t* sizes, size_t total_sizes, uint64_t* counts)
+{
+    uint64_t* sums = calloc(total_sizes, sizeof(uint64_t));
+    if (sums == NULL) return -1;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        uint64_t value = array[index];
+
+        for (size_t size_index = 0; size_index < total_sizes; ++size_index)
+        {
+            size_t size = sizes[size_index];
+
+            if (index < size)
+            {
+                sums[size_index] += value;
+                continue;
+            }
+
+            uint64_t sum = sums[size_index] + value - array[index - size];
+            if (sum > sums[size_index]) counts[size_index] += 1;
+
+            sums[size_index] = sum;
+        }
+    }
+
+    free(sums);
+
+    return 0;
+}
+
+int count_increasing_windows(const uint64_t* array, size_t length, const size_t* sizes, size_t total_sizes, uint64_t* counts)
+{
+    memset(counts, 0, total_sizes * sizeof(uint64_t));
+
+    size_t largest = 0;
+
+    for (size_t size_index = 0; size_index < total_sizes; ++size_index)
+    {
+        if (sizes[size_index] == 0)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+
+        if (sizes[size_index] > largest) largest = sizes[size_index];
+    }
+
+    uint64_t maximum = 0;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        if (array[index] > maximum) maximum = array[index];
+    }
+
+    if (largest != 0 && maximum > UINT64_MAX / largest) return count_windows_wrapping(array, length, sizes, total_sizes, counts);
+
+    const struct count_functions* functions = count_functions();
+
+    for (size_t begin = 0; begin < length; begin += WINDOW_TILE)
+    {
+        for (size_t size_index = 0; size_index < total_sizes; ++size_index)
+        {
+            size_t size = sizes[size_index];
+            if (begin + size >= length) continue;
+
+            size_t end = begin + WINDOW_TILE + size;
+            if (end > length) end = length;
+
+            counts[size_index] += functions->shifted(array + begin, end - begin, size);
+        }
+    }
+
+    return 0;
+}
+
+int count_series_windows(const struct buffer* array, const size_t* sizes, size_t total_sizes, uint64_t* counts)
+{
+    if (array->element_size == sizeof(uint64_t)) return count_increasing_windows(array->data, array->length, sizes, total_sizes, counts);
+
+    memset(counts, 0, total_sizes * sizeof(uint64_t));
+
+    for (size_t size_index = 0; size_index < total_sizes; ++size_index)
+    {
+        if (sizes[size_index] == 0)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+    }
+
+    const struct count_functions* functions = count_functions();
+
+    const char* data = array->data;
+    size_t width = array->element_size;
+    size_t length = array->length;
+
+    for (size_t begin = 0; begin < length; begin += WINDOW_TILE)
+    {
+        for (size_t size_index = 0; size_index < total_sizes; ++size_index)
+        {
+            size_t size = sizes[size_index];
+            if (begin + size >= length) continue;
+
+            size_t end = begin + WINDOW_TILE + size;
+            if (end > length) end = length;
+
+            counts[size_index] += count_width_shifted(functions, data + begin * width, width, end - begin, size);
+        }
+    }
+
+    return 0;
+}
+
+static inline void increasing_counter_step(struct increasing_counter* counter, uint64_t value)
+{
+    uint64_t previous_1 = counter->previous[0];
+    uint64_t previous_2 = counter->previous[1];
+    uint64_t previous_3 = counter->previous[2];
+
+    if (counter->total < 3) counter->first[counter->total] = value;
+
+    if (counter->total >= 1 && value > previous_3) counter->pairs += 1;
+    if (counter->total >= 3 && previous_2 + previous_3 + value > previous_1 + previous_2 + previous_3) counter->windows += 1;
+
+    counter->previous[0] = previous_2;
+    counter->previous[1] = previous_3;
+    counter->previous[2] = value;
+
+    counter->total += 1;
+}
+
+void increasing_counter_update(struct increasing_counter* counter, const uint64_t* array, size_t length)
+{
+    struct increasing_counter state = *counter;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        increasing_counter_step(&state, array[index]);
+    }
+
+    *counter = state;
+}
+
+void increasing_counter_merge(struct increasing_counter* counter, const struct increasing_counter* next)
+{
+    struct increasing_counter state = *counter;
+
+    size_t head = next->total < 3 ? next->total : 3;
+
+    for (size_t index = 0; index < head; ++index)
+    {
+        increasing_counter_step(&state, next->first[index]);
+    }
+
+    for (size_t index = 1; index < head; ++index)
+    {
+        if (next->first[index] > next->first[index - 1]) state.pairs -= 1;
+    }
+
+    state.pairs += next->pairs;
+    state.windows += next->windows;
+
+    if (next->total > 3)
+    {
+        memcpy(state.previous, next->previous, sizeof(state.previous));
+        state.total = counter->total + next->total;
+    }
+
+    *counter = state;
+}
+
+void challenge_1_count(const char* str, const char* last, struct increasing_counter* counter)
+{
+    struct increasing_counter state = *counter;
+
+    while (str != last)
+    {
+        const char* end;
+
+        end = last;
+        scan_non_digit(str, &end);
+
+        str = end;
+
+        end = last;
+        uint64_t value = scan_decimal(str, &end);
+
+        if (str != end) increasing_counter_step(&state, value);
+
+        str = end;
+    }
+
+    *counter = state;
+}
+
+static void* count_range_main(void* argument)
+{
+    struct count_range* range = argument;
+    challenge_1_count(range->str, range->last, &range->counter);
+
+    return NULL;
+}
+
+int challenge_1_count_parallel(const char* str, const char* last, size_t total_threads, struct increasing_counter* counter)
+{
+    size_t length = last - str;
+    if (total_threads > length) total_threads = length;
+
+    if (total_threads <= 1)
+    {
+        challenge_1_count(str, last, counter);
+        return 0;
+    }
+
+    struct count_range* ranges = calloc(total_threads, sizeof(struct count_range));
+    if (ranges == NULL) return -1;
+
+    const char* begin = str;
+
+    for (size_t index = 0; index < total_threads; ++index)
+    {
+        const char* end = str + length * (index + 1) / total_threads;
+        if (end < begin) end = begin;
+
+        if (end != last)
+        {
+            const char* line_end = memchr(end, '\n', last - end);
+            end = line_end == NULL ? last : line_end + 1;
+        }
+
+        ranges[index].str = begin;
+        ranges[index].last = end;
+
+        begin = end;
+    }
+
+    for (size_t index = 1; index < total_threads; ++index)
+    {
+        struct count_range* range = &ranges[index];
+
+        if (pthread_create(&range->thread, NULL, count_range_main, range) == 0) range->started = 1;
+        else count_range_main(range);
+    }
+
+    count_range_main(&ranges[0]);
+
+    for (size_t index = 0; index < total_threads; ++index)
+    {
+        if (ranges[index].started) pthread_join(ranges[index].thread, NULL);
+        increasing_counter_merge(counter, &ranges[index].counter);
+    }
+
+    free(ranges);
+
+    return 0;
+}
+
+void challenge_1_init(struct challenge_1_workspace* workspace)
+{
+    buffer_init(&workspace->array, sizeof(uint16_t));
+
+    workspace->stats = NULL;
+}
+
+void challenge_1_free(struct challenge_1_workspace* workspace)
+{
+    buffer_free(&workspace->array);
+}
+
+int challenge_1_parse(const struct input* input, const size_t* hints, struct challenge_1_workspace* workspace)
+{
+    struct buffer* array = &workspace->array;
+    series_reset(array);
+
+    if (buffer_reserve(array, hints[0]) == -1) return -1;
+    return read_input(input, array);
+}
+
+int challenge_1_finish(struct challenge_1_workspace* workspace, const size_t* hints, struct solver_answers* answers)
+{
+    (void) hints;
+
+    struct buffer* array = &workspace->array;
+
+    uint64_t answer_1 = count_series_pairs(array);
+    uint64_t answer_2 = count_series_3_segment_windows(array);
+
+    solver_set_u64(answers, answer_1, answer_2);
+
+    return 0;
+}
+
+int challenge_1_load(const struct cache* cache, struct challenge_1_workspace* workspace)
+{
+    struct buffer* array = &workspace->array;
+    series_reset(array);
+
+    size_t length = cache->params[0];
+    if (buffer_reserve(array, length) == -1) return -1;
+
+    const uint8_t* str = cache->sections[0];
+    const uint8_t* last = str + cache->section_sizes[0];
+
+    uint64_t previous = 0;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        uint64_t delta = 0;
+        size_t shift = 0;
+
+        while (1)
+        {
+            if (str == last || shift >= 64)
+            {
+                errno = ESTALE;
+                return -1;
+            }
+
+            uint8_t byte = *str++;
+            delta |= (uint64_t) (byte & 0x7F) << shift;
+
+            if ((byte & 0x80) == 0) break;
+            shift += 7;
+        }
+
+        previous += (delta >> 1) ^ -(delta & 1);
+        if (series_push(array, previous) == -1) return -1;
+    }
+
+    return 0;
+}
+
+int challenge_1_store(const char* name, const struct challenge_1_workspace* workspace)
+{
+    const struct buffer* array = &workspace->array;
+    size_t length = array->length;
+
+    struct buffer bytes;
+    buffer_init(&bytes, sizeof(uint8_t));
+
+    if (buffer_reserve(&bytes, length * 10 + 1) == -1) return -1;
+
+    uint8_t* str = bytes.data;
+    uint64_t previous = 0;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        uint64_t value = series_load(array->data, array->element_size, index);
+
+        int64_t delta = value - previous;
+        uint64_t zigzag = ((uint64_t) delta << 1) ^ (uint64_t) (delta >> 63);
+
+        while (zigzag >= 0x80)
+        {
+            *str++ = (uint8_t) (zigzag | 0x80);
+            zigzag >>= 7;
+        }
+
+        *str++ = (uint8_t) zigzag;
+        previous = value;
+    }
+
+    uint64_t params[CACHE_PARAMS] = {length};
+
+    const void* sections[CACHE_SECTIONS] = {bytes.data, NULL};
+    size_t section_sizes[CACHE_SECTIONS] = {str - (uint8_t*) bytes.data, 0};
+
+    int result = cache_write(name, 1, params, sections, section_sizes);
+    buffer_free(&bytes);
+
+    return result;
+}
+
+int challenge_1_solve(const struct input* input, const size_t* hints, struct challenge_1_workspace* workspace, struct solver_answers* answers)
+{
+    stats_begin(workspace->stats);
+    if (challenge_1_parse(input, hints, workspace) == -1) return -1;
+
+    stats_end(workspace->stats, stats_parse);
+
+    int result = challenge_1_finish(workspace, hints, answers);
+    stats_end(workspace->stats, stats_solve);
+
+    return result;
+}
+
+static void init_workspace(void* workspace)
+{
+    challenge_1_init(workspace);
+}
+
+static void free_workspace(void* workspace)
+{
+    challenge_1_free(workspace);
+}
+
+static int solve_input(const struct input* input, const size_t* hints, void* workspace, struct solver_answers* answers)
+{
+    return challenge_1_solve(input, hints, workspace, answers);
+}
+
+const struct solver challenge_1_solver = {"1", sizeof(struct challenge_1_workspace), init_workspace, free_workspace, solve_input};
@@ -0,0 +1,62 @@
+#ifndef CHALLENGE_1_H
+#define CHALLENGE_1_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+enum count_level
+{
+    count_level_scalar = 0,
+    count_level_avx2 = 1,
+    count_level_avx512 = 2,
+};
+
+struct increasing_counter
+{
+    uint64_t pairs;
+    uint64_t windows;
+
+    uint64_t first[3];
+    uint64_t previous[3];
+    size_t total;
+};
+
+struct challenge_1_workspace
+{
+    struct buffer array;
+
+    struct stats* stats;
+};
+
+extern const struct solver challenge_1_solver;
+
+uint64_t challenge_1_value(const struct buffer* array, size_t index);
+int challenge_1_widen(struct buffer* array, size_t width);
+int challenge_1_read(const char* str, const char* last, struct buffer* array);
+enum count_level count_select(enum count_level level);
+uint64_t count_increasing_pairs(const uint64_t* array, size_t length);
+uint64_t count_increasing_3_segment_windows(const uint64_t* array, size_t length);
+uint64_t count_series_pairs(const struct buffer* array);
+uint64_t count_series_3_segment_windows(const struct buffer* array);
+int count_increasing_windows(const uint64_t* array, size_t length, const size_t* sizes, size_t total_sizes, uint64_t* counts);
+int count_series_windows(const struct buffer* array, const size_t* sizes, size_t total_sizes, uint64_t* counts);
+void increasing_counter_update(struct increasing_counter* counter, const uint64_t* array, size_t length);
+void increasing_counter_merge(struct increasing_counter* counter, const struct increasing_counter* next);
+void challenge_1_count(const char* str, const char* last, struct increasing_counter* counter);
+int challenge_1_count_parallel(const char* str, const char* last, size_t total_threads, struct increasing_counter* counter);
+
+void challenge_1_init(struct challenge_1_workspace* workspace);
+void challenge_1_free(struct challenge_1_workspace* workspace);
+int challenge_1_parse(const struct input* input, const size_t* hints, struct challenge_1_workspace* workspace);
+int challenge_1_finish(struct challenge_1_workspace* workspace, const size_t* hints, struct solver_answers* answers);
+int challenge_1_load(const struct cache* cache, struct challenge_1_workspace* workspace);
+int challenge_1_store(const char* name, const struct challenge_1_workspace* workspace);
+int challenge_1_solve(const struct input* input, const size_t* hints, struct challenge_1_workspace* workspace, struct solver_answers* answers);
+
+#endif
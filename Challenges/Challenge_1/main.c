@@ -1,155 +1,294 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <inttypes.h>
-#include <ctype.h>
 #include <string.h>
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 #include <unistd.h>
-#include <fcntl.h>
-#include <sys/types.h>
-#include <sys/stat.h>
 
-void skip_space(char* str, char** end)
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/stream.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+#include "../Common/rolling.h"
+
+#include "challenge_1.h"
+
+struct stream_context
 {
-    char* a = *end;
+    struct increasing_counter counter;
 
-    while (str != a)
-    {
-        if (!isspace(*str)) break;
-        str += 1;
-    }
+    struct stats* stats;
+};
+
+static const char* consume_chunk(const char* str, const char* last, int final, void* context)
+{
+    struct stream_context* c = context;
+
+    const char* end = final ? last : stream_split(str, last, '\n');
+
+    stats_end(c->stats, stats_read);
 
-    *end = str;
+    challenge_1_count(str, end, &c->counter);
+    stats_end(c->stats, stats_parse);
+
+    return end;
 }
 
-int read_input(const char* name, uint64_t* array, size_t* length)
+static int solve_fused(const char* name, size_t total_threads, struct stats* stats, struct solver_answers* answers)
 {
-    int file = -1;
-    char* mem = NULL;
-    
-    file = open(name, O_RDONLY);
-    if (file == -1) goto cleanup;
+    struct input input;
 
-    struct stat64 stat;
-    fstat64(file, &stat);
+    stats_begin(stats);
+    if (input_open(name, &input) == -1) return -1;
 
-    mem = malloc(stat.st_size + 1);
-    if (mem == NULL) goto cleanup;
+    stats_end(stats, stats_read);
 
-    size_t mem_index = 0;
-    size_t mem_remaining = stat.st_size;
+    struct increasing_counter counter;
+    memset(&counter, 0, sizeof(struct increasing_counter));
 
-    while (mem_remaining != 0)
-    {
-        ssize_t chars = read(file, mem + mem_index, mem_remaining);
-        if (chars == -1) goto cleanup;
+    int result = challenge_1_count_parallel(input.begin, input.end, total_threads, &counter);
+    stats_end(stats, stats_parse);
 
-        mem_index += chars;
-        mem_remaining -= chars;
-    }
-    
-    char* last = mem + mem_index;
-    *last = 0;
+    solver_set_u64(answers, counter.pairs, counter.windows);
+    input_close(&input);
 
-    char* str = mem;
+    return result;
+}
 
-    size_t index = 0;
-    size_t max_length = *length;
+static int solve_stream(const char* name, struct stats* stats, struct solver_answers* answers)
+{
+    int file = stream_open(name);
+    if (file == -1) return -1;
 
-    while (index < max_length)
-    {
-        char* end;
-
-        end = last;
-        skip_space(str, &end);
-
-        str = end;
-        
-        end = last;
-        uint64_t value = strtoull(str, &end, 10);
-        
-        if (str != end) array[index++] = value;
-        if (str == last) break;
-        
-        str = end;
-    }
-    
-    *length = index;
-    
-    cleanup: if (file != -1) close(file);
-    if (mem != NULL) free(mem);
-    
-    return file;
+    struct stream_context context;
+    memset(&context, 0, sizeof(struct stream_context));
+
+    context.stats = stats;
+    stats_begin(stats);
+
+    int result = stream_run(file, consume_chunk, &context);
+
+    solver_set_u64(answers, context.counter.pairs, context.counter.windows);
+
+    stream_close(file);
+
+    return result;
 }
 
-uint64_t count_increasing_pairs(const uint64_t* array, size_t length)
+static int print_windows(struct challenge_1_workspace* workspace, const struct buffer* sizes)
 {
-    if (length == 0) return 0;
+    struct buffer counts;
+    buffer_init(&counts, sizeof(uint64_t));
 
-    uint64_t count = 0;
-    uint64_t previous = array[0];
+    if (buffer_reserve(&counts, sizes->length) == -1) return -1;
 
-    for (uint64_t index = 1; index < length; ++index)
+    const size_t* size = sizes->data;
+    const uint64_t* count = counts.data;
+
+    int result = count_series_windows(&workspace->array, size, sizes->length, counts.data);
+
+    for (size_t index = 0; result != -1 && index < sizes->length; ++index)
     {
-        if (array[index] > previous) count += 1;
-        previous = array[index];
+        printf("WINDOW %zu: %" PRIu64 "\n", size[index], count[index]);
     }
-    
-    return count;
+
+    buffer_free(&counts);
+
+    return result;
 }
 
-uint64_t count_increasing_3_segment_windows(const uint64_t* array, size_t length)
+static int print_rolling(struct challenge_1_workspace* workspace, const struct buffer* sizes)
 {
-    if (length < 3) return 0;
+    int result = -1;
+    size_t started = 0;
+
+    const size_t* size = sizes->data;
+
+    struct rolling* windows = calloc(sizes->length, sizeof(struct rolling));
+    if (windows == NULL) return -1;
+
+    for (; started < sizes->length; ++started)
+    {
+        if (rolling_init(&windows[started], size[started]) == -1) goto cleanup;
+    }
+
+    for (size_t index = 0; index < workspace->array.length; ++index)
+    {
+        uint64_t value = challenge_1_value(&workspace->array, index);
+
+        for (size_t size_index = 0; size_index < sizes->length; ++size_index)
+        {
+            struct rolling_result window;
 
-    uint64_t count = 0;
+            int full = rolling_push(&windows[size_index], value, &window);
+            if (full == -1) goto cleanup;
 
-    uint64_t previous_1 = array[0];
-    uint64_t previous_2 = array[1];
-    uint64_t previous_3 = array[2];
+            if (full)
+            {
+                printf("ROLLING %zu %zu: %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 "\n",
+                    size[size_index], index, window.minimum, window.maximum, window.sum, window.median);
+            }
+        }
+    }
 
-    uint64_t previous_sum = previous_1 + previous_2 + previous_3;
+    result = 0;
 
-    for (uint64_t index = 3; index < length; ++index)
+    cleanup: for (size_t index = 0; index < started; ++index)
     {
-        uint64_t sum = previous_2 + previous_3 + array[index];
-        if (sum > previous_sum) count += 1;
-
-        previous_1 = previous_2;
-        previous_2 = previous_3;
-        previous_3 = array[index];
-        
-        previous_sum = sum;
+        rolling_free(&windows[index]);
     }
-    
-    return count;
+
+    free(windows);
+
+    return result;
 }
 
 int main(int argc, char** argv)
 {
-    if (argc < 3) return EXIT_FAILURE;
-    
-    uint64_t* array = NULL;
-    size_t length = strtoull(argv[2], NULL, 10);
-    
-    array = malloc(length * sizeof(uint64_t));
-    if (array == NULL) goto cleanup;
-
-    if (read_input(argv[1], array, &length) == -1)
+    struct stats stats;
+    struct stats* active_stats = NULL;
+
+    int write_cache = solver_flag(&argc, argv, "--cache");
+    int fused = solver_flag(&argc, argv, "--fused");
+    size_t total_threads = solver_option(&argc, argv, "--threads", sysconf(_SC_NPROCESSORS_ONLN));
+    const char* windows = solver_argument(&argc, argv, "--windows");
+    const char* rolling = solver_argument(&argc, argv, "--rolling");
+
+    if (solver_flag(&argc, argv, "--stats"))
+    {
+        stats_init(&stats);
+        active_stats = &stats;
+    }
+
+    if (argc < 2) return EXIT_FAILURE;
+
+    size_t hints[SOLVER_MAX_HINTS];
+    solver_parse_hints(argc - 2, argv + 2, hints);
+
+    struct solver_answers answers;
+
+    struct challenge_1_workspace workspace;
+    challenge_1_init(&workspace);
+
+    struct buffer sizes;
+    struct buffer rolling_sizes;
+
+    buffer_init(&sizes, sizeof(size_t));
+    buffer_init(&rolling_sizes, sizeof(size_t));
+
+    int status = EXIT_SUCCESS;
+    int result = 0;
+
+    if (windows != NULL && solver_parse_list(windows, &sizes) == -1)
+    {
+        perror("Failed to read window sizes");
+        status = EXIT_FAILURE;
+        goto cleanup;
+    }
+
+    if (rolling != NULL && solver_parse_list(rolling, &rolling_sizes) == -1)
+    {
+        perror("Failed to read rolling window sizes");
+        status = EXIT_FAILURE;
+        goto cleanup;
+    }
+
+    if ((windows != NULL || rolling != NULL) && (fused || stream_wanted(argv[1])))
+    {
+        errno = EINVAL;
+
+        perror("Window sizes need a mapped input");
+        status = EXIT_FAILURE;
+        goto cleanup;
+    }
+
+    if (stream_wanted(argv[1]))
+    {
+        if (solve_stream(argv[1], active_stats, &answers) == -1)
+        {
+            perror("Failed to read input stream");
+            status = EXIT_FAILURE;
+            goto cleanup;
+        }
+    }
+    else if (fused)
+    {
+        if (solve_fused(argv[1], total_threads, active_stats, &answers) == -1)
+        {
+            perror("Failed to read input file");
+            status = EXIT_FAILURE;
+            goto cleanup;
+        }
+    }
+    else
+    {
+        struct cache cache;
+        struct input input;
+
+        stats_begin(active_stats);
+
+        if (cache_open(argv[1], 1, &cache) == 0)
+        {
+            stats_end(active_stats, stats_read);
+
+            result = challenge_1_load(&cache, &workspace);
+            cache_close(&cache);
+        }
+        else
+        {
+            if (input_open(argv[1], &input) == -1)
+            {
+                perror("Failed to read input file");
+                status = EXIT_FAILURE;
+                goto cleanup;
+            }
+
+            stats_end(active_stats, stats_read);
+
+            result = challenge_1_parse(&input, hints, &workspace);
+            input_close(&input);
+
+            if (result != -1 && write_cache && challenge_1_store(argv[1], &workspace) == -1) perror("Failed to write cache");
+        }
+
+        stats_end(active_stats, stats_parse);
+
+        if (result != -1) result = challenge_1_finish(&workspace, hints, &answers);
+        stats_end(active_stats, stats_solve);
+
+        if (result == -1)
+        {
+            perror("Failed to parse input file");
+            status = EXIT_FAILURE;
+            goto cleanup;
+        }
+    }
+
+    solver_print(&answers);
+
+    if (sizes.length != 0 && print_windows(&workspace, &sizes) == -1)
+    {
+        perror("Failed to count windows");
+        status = EXIT_FAILURE;
+    }
+
+    if (rolling_sizes.length != 0 && print_rolling(&workspace, &rolling_sizes) == -1)
     {
-        perror("Failed to read input file");
-        return EXIT_FAILURE;
+        perror("Failed to compute rolling windows");
+        status = EXIT_FAILURE;
     }
-    
-    uint64_t answer_1 = count_increasing_pairs(array, length);
-    uint64_t answer_2 = count_increasing_3_segment_windows(array, length);
-    
-    printf("ANSWER PART I: %" PRIu64 "\n", answer_1);
-    printf("ANSWER PART II: %" PRIu64 "\n", answer_2);
-    
-    cleanup: if (array != NULL) free(array);
-
-    return EXIT_SUCCESS;
+
+    if (active_stats != NULL) stats_print(active_stats, 1);
+
+    cleanup: challenge_1_free(&workspace);
+    buffer_free(&sizes);
+    buffer_free(&rolling_sizes);
+    if (active_stats != NULL) stats_free(active_stats);
+
+    return status;
 }
@@ -0,0 +1,902 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NAVIGATION_X86 1
+#else
+#define NAVIGATION_X86 0
+#endif
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+#include "challenge_2.h"
+
+#define NAVIGATION_BLOCK (1 << 16)
+#define NAVIGATION_LANE_LIMIT ((uint64_t) 1 << 31)
+
+struct navigation_lane
+{
+    uint64_t horizontal;
+    uint64_t depth;
+    uint64_t aim;
+
+    uint64_t total;
+};
+
+struct keyword
+{
+    const char* text;
+    size_t length;
+
+    enum direction direction;
+};
+
+static const struct keyword keywords[256] =
+{
+    ['f'] = {"forward", 7, direction_forward},
+    ['u'] = {"up", 2, direction_up},
+    ['d'] = {"down", 4, direction_down},
+};
+
+static const uint8_t spaces[256] =
+{
+    [' '] = 1, ['\t'] = 1, ['\n'] = 1, ['\v'] = 1, ['\f'] = 1, ['\r'] = 1,
+};
+
+struct navigation_functions
+{
+    void (*scan)(const struct movement* movements, size_t length, size_t step_stride, size_t lane_stride, struct navigation_lane* lanes);
+};
+
+struct fleet_entry
+{
+    size_t length;
+    size_t script;
+};
+
+struct navigation_range
+{
+    pthread_t thread;
+    int started;
+
+    const struct movement* array;
+    size_t length;
+
+    struct navigation summary;
+};
+
+static void skip_space(const char* str, const char** end)
+{
+    const char* a = *end;
+
+    while (str != a)
+    {
+        if (!spaces[(unsigned char) *str]) break;
+        str += 1;
+    }
+
+    *end = str;
+}
+
+static int read_keyword(const char* str, const char* last, const char** end, enum direction* direction)
+{
+    const struct keyword* keyword = &keywords[(unsigned char) *str];
+    size_t length = keyword->length;
+
+    if (length == 0 || (size_t) (last - str) <= length || memcmp(str, keyword->text, length) != 0 || !spaces[(unsigned char) str[length]])
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    *end = str + length;
+    *direction = keyword->direction;
+
+    return 0;
+}
+
+int challenge_2_read(const char* str, const char* last, struct buffer* array)
+{
+    while (str != last)
+    {
+        const char* end;
+
+        end = last;
+        skip_space(str, &end);
+
+        str = end;
+        if (str == last) break;
+
+        enum direction direction;
+        if (read_keyword(str, last, &end, &direction) == -1) return -1;
+
+        str = end;
+
+        end = last;
+        skip_space(str, &end);
+
+        str = end;
+
+        end = str;
+        uint64_t value = 0;
+
+        while (end != last && (unsigned char) (*end - '0') < 10)
+        {
+            value = value * 10 + (uint64_t) (*end - '0');
+            end += 1;
+        }
+
+        if (str == end || (end != last && !spaces[(unsigned char) *end]))
+        {
+            errno = EINVAL;
+            return -1;
+        }
+
+        if (end - str > 10 || value > MOVEMENT_MAX_VALUE)
+        {
+            errno = ERANGE;
+            return -1;
+        }
+
+        struct movement* slot = buffer_push(array);
+        if (slot == NULL) return -1;
+
+        *slot = movement_pack(direction, value);
+
+        str = end;
+    }
+
+    return 0;
+}
+
+static int read_input(const struct input* input, struct buffer* array)
+{
+    return challenge_2_read(input->begin, input->end, array);
+}
+
+void navigation_merge(struct navigation* navigation, const struct navigation* next)
+{
+    navigation->position.horizontal += next->position.horizontal;
+    navigation->position.depth += next->position.depth;
+
+    navigation->position_with_aim.horizontal += next->position_with_aim.horizontal;
+    navigation->position_with_aim.depth += next->position_with_aim.depth + navigation->aim * next->position.horizontal;
+
+    navigation->aim += next->aim;
+}
+
+static const int64_t forward_factors[4] = {[direction_forward] = 1};
+static const int64_t aim_factors[4] = {[direction_up] = -1, [direction_down] = 1};
+
+static inline void lane_step(struct navigation_lane* lane, struct movement movement)
+{
+    uint64_t value = movement_value(movement);
+    enum direction direction = movement_direction(movement);
+
+    uint64_t forward = value * (uint64_t) forward_factors[direction];
+
+    lane->aim += value * (uint64_t) aim_factors[direction];
+    lane->horizontal += forward;
+    lane->depth += lane->aim * forward;
+    lane->total += value;
+}
+
+static void navigation_step(struct navigation* navigation, struct movement movement)
+{
+    __int128 value = movement_value(movement);
+    enum direction direction = movement_direction(movement);
+
+    __int128 forward = value * forward_factors[direction];
+    __int128 turn = value * aim_factors[direction];
+
+    navigation->aim += turn;
+
+    navigation->position.horizontal += forward;
+    navigation->position.depth += turn;
+
+    navigation->position_with_aim.horizontal += forward;
+    navigation->position_with_aim.depth += navigation->aim * forward;
+}
+
+static void lane_merge(struct navigation* navigation, const struct navigation_lane* lane)
+{
+    struct navigation next;
+
+    next.position.horizontal = (int64_t) lane->horizontal;
+    next.position.depth = (int64_t) lane->aim;
+
+    next.position_with_aim.horizontal = (int64_t) lane->horizontal;
+    next.position_with_aim.depth = (int64_t) lane->depth;
+
+    next.aim = (int64_t) lane->aim;
+
+    navigation_merge(navigation, &next);
+}
+
+static void merge_lane(struct navigation* navigation, const struct navigation_lane* lane, const struct movement* array, size_t length)
+{
+    if (lane->total < NAVIGATION_LANE_LIMIT)
+    {
+        lane_merge(navigation, lane);
+        return;
+    }
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        navigation_step(navigation, array[index]);
+    }
+}
+
+static void navigation_scan_scalar(const struct movement* movements, size_t length, size_t step_stride, size_t lane_stride, struct navigation_lane* lanes)
+{
+    memset(lanes, 0, NAVIGATION_LANES * sizeof(struct navigation_lane));
+
+    for (size_t step = 0; step < length; ++step)
+    {
+        for (size_t lane = 0; lane < NAVIGATION_LANES; ++lane)
+        {
+            lane_step(&lanes[lane], movements[step * step_stride + lane * lane_stride]);
+        }
+    }
+}
+
+static void navigation_store_lanes(const uint64_t* horizontal, const uint64_t* depth, const uint64_t* aim, const uint64_t* total, struct navigation_lane* lanes)
+{
+    for (size_t lane = 0; lane < NAVIGATION_LANES; ++lane)
+    {
+        lanes[lane].horizontal = horizontal[lane];
+        lanes[lane].depth = depth[lane];
+        lanes[lane].aim = aim[lane];
+        lanes[lane].total = total[lane];
+    }
+}
+
+#if NAVIGATION_X86
+
+__attribute__((target("avx2")))
+static inline __m256i multiply_avx2(__m256i a, __m256i b)
+{
+    __m256i low = _mm256_mul_epu32(a, b);
+    __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+
+    return _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i load_lanes_avx2(const struct movement* movements, size_t lane_stride, __m256i offsets_0, __m256i offsets_1)
+{
+    if (lane_stride == 1) return _mm256_loadu_si256((const __m256i*) movements);
+
+    __m128i low = _mm256_i64gather_epi32((const int*) movements, offsets_0, sizeof(struct movement));
+    __m128i high = _mm256_i64gather_epi32((const int*) movements, offsets_1, sizeof(struct movement));
+
+    return _mm256_set_m128i(high, low);
+}
+
+__attribute__((target("avx2")))
+static void navigation_scan_avx2(const struct movement* movements, size_t length, size_t step_stride, size_t lane_stride, struct navigation_lane* lanes)
+{
+    __m256i mask = _mm256_set1_epi32((1 << MOVEMENT_DIRECTION_BITS) - 1);
+    __m256i offsets_0 = _mm256_setr_epi64x(0, lane_stride, 2 * lane_stride, 3 * lane_stride);
+    __m256i offsets_1 = _mm256_add_epi64(offsets_0, _mm256_set1_epi64x(4 * lane_stride));
+
+    __m256i forward_code = _mm256_set1_epi32(direction_forward);
+    __m256i up_code = _mm256_set1_epi32(direction_up);
+    __m256i down_code = _mm256_set1_epi32(direction_down);
+
+    __m256i horizontal_0 = _mm256_setzero_si256();
+    __m256i horizontal_1 = _mm256_setzero_si256();
+    __m256i depth_0 = _mm256_setzero_si256();
+    __m256i depth_1 = _mm256_setzero_si256();
+    __m256i aim_0 = _mm256_setzero_si256();
+    __m256i aim_1 = _mm256_setzero_si256();
+    __m256i total_0 = _mm256_setzero_si256();
+    __m256i total_1 = _mm256_setzero_si256();
+
+    for (size_t step = 0; step < length; ++step)
+    {
+        __m256i packed = load_lanes_avx2(&movements[step * step_stride], lane_stride, offsets_0, offsets_1);
+
+        __m256i value = _mm256_srli_epi32(packed, MOVEMENT_DIRECTION_BITS);
+        __m256i direction = _mm256_and_si256(packed, mask);
+
+        __m256i forward = _mm256_and_si256(value, _mm256_cmpeq_epi32(direction, forward_code));
+        __m256i up = _mm256_and_si256(value, _mm256_cmpeq_epi32(direction, up_code));
+        __m256i down = _mm256_and_si256(value, _mm256_cmpeq_epi32(direction, down_code));
+        __m256i turn = _mm256_sub_epi32(down, up);
+
+        __m256i forward_0 = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(forward));
+        __m256i forward_1 = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(forward, 1));
+
+        aim_0 = _mm256_add_epi64(aim_0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(turn)));
+        aim_1 = _mm256_add_epi64(aim_1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(turn, 1)));
+
+        horizontal_0 = _mm256_add_epi64(horizontal_0, forward_0);
+        horizontal_1 = _mm256_add_epi64(horizontal_1, forward_1);
+
+        depth_0 = _mm256_add_epi64(depth_0, multiply_avx2(aim_0, forward_0));
+        depth_1 = _mm256_add_epi64(depth_1, multiply_avx2(aim_1, forward_1));
+
+        total_0 = _mm256_add_epi64(total_0, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(value)));
+        total_1 = _mm256_add_epi64(total_1, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(value, 1)));
+    }
+
+    uint64_t horizontal[NAVIGATION_LANES];
+    uint64_t depth[NAVIGATION_LANES];
+    uint64_t aim[NAVIGATION_LANES];
+    uint64_t total[NAVIGATION_LANES];
+
+    _mm256_storeu_si256((__m256i*) &horizontal[0], horizontal_0);
+    _mm256_storeu_si256((__m256i*) &horizontal[4], horizontal_1);
+    _mm256_storeu_si256((__m256i*) &depth[0], depth_0);
+    _mm256_storeu_si256((__m256i*) &depth[4], depth_1);
+    _mm256_storeu_si256((__m256i*) &aim[0], aim_0);
+    _mm256_storeu_si256((__m256i*) &aim[4], aim_1);
+    _mm256_storeu_si256((__m256i*) &total[0], total_0);
+    _mm256_storeu_si256((__m256i*) &total[4], total_1);
+
+    navigation_store_lanes(horizontal, depth, aim, total, lanes);
+}
+
+__attribute__((target("avx512f")))
+static inline __m512i multiply_avx512(__m512i a, __m512i b)
+{
+    __m512i low = _mm512_mul_epu32(a, b);
+    __m512i high = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), b);
+
+    return _mm512_add_epi64(low, _mm512_slli_epi64(high, 32));
+}
+
+__attribute__((target("avx512f")))
+static inline __m256i load_lanes_avx512(const struct movement* movements, size_t lane_stride, __m512i offsets)
+{
+    if (lane_stride == 1) return _mm256_loadu_si256((const __m256i*) movements);
+    return _mm512_i64gather_epi32(offsets, (const int*) movements, sizeof(struct movement));
+}
+
+__attribute__((target("avx512f")))
+static void navigation_scan_avx512(const struct movement* movements, size_t length, size_t step_stride, size_t lane_stride, struct navigation_lane* lanes)
+{
+    __m512i zero = _mm512_setzero_si512();
+    __m512i offsets = _mm512_setr_epi64(0, lane_stride, 2 * lane_stride, 3 * lane_stride, 4 * lane_stride, 5 * lane_stride, 6 * lane_stride, 7 * lane_stride);
+    __m512i mask = _mm512_set1_epi64((1 << MOVEMENT_DIRECTION_BITS) - 1);
+
+    __m512i forward_code = _mm512_set1_epi64(direction_forward);
+    __m512i up_code = _mm512_set1_epi64(direction_up);
+    __m512i down_code = _mm512_set1_epi64(direction_down);
+
+    __m512i horizontal = zero;
+    __m512i depth = zero;
+    __m512i aim = zero;
+    __m512i total = zero;
+
+    for (size_t step = 0; step < length; ++step)
+    {
+        __m512i packed = _mm512_cvtepu32_epi64(load_lanes_avx512(&movements[step * step_stride], lane_stride, offsets));
+
+        __m512i value = _mm512_srli_epi64(packed, MOVEMENT_DIRECTION_BITS);
+        __m512i direction = _mm512_and_si512(packed, mask);
+
+        __m512i forward = _mm512_maskz_mov_epi64(_mm512_cmpeq_epi64_mask(direction, forward_code), value);
+
+        aim = _mm512_mask_add_epi64(aim, _mm512_cmpeq_epi64_mask(direction, down_code), aim, value);
+        aim = _mm512_mask_sub_epi64(aim, _mm512_cmpeq_epi64_mask(direction, up_code), aim, value);
+
+        horizontal = _mm512_add_epi64(horizontal, forward);
+        depth = _mm512_add_epi64(depth, multiply_avx512(aim, forward));
+        total = _mm512_add_epi64(total, value);
+    }
+
+    uint64_t horizontal_lanes[NAVIGATION_LANES];
+    uint64_t depth_lanes[NAVIGATION_LANES];
+    uint64_t aim_lanes[NAVIGATION_LANES];
+    uint64_t total_lanes[NAVIGATION_LANES];
+
+    _mm512_storeu_si512(horizontal_lanes, horizontal);
+    _mm512_storeu_si512(depth_lanes, depth);
+    _mm512_storeu_si512(aim_lanes, aim);
+    _mm512_storeu_si512(total_lanes, total);
+
+    navigation_store_lanes(horizontal_lanes, depth_lanes, aim_lanes, total_lanes, lanes);
+}
+
+#endif
+
+static const struct navigation_functions navigation_levels[] =
+{
+    [navigation_level_scalar] = {navigation_scan_scalar},
+#if NAVIGATION_X86
+    [navigation_level_avx2] = {navigation_scan_avx2},
+    [navigation_level_avx512] = {navigation_scan_avx512},
+#endif
+};
+
+static const struct navigation_functions* navigation_selected = NULL;
+static pthread_once_t navigation_once = PTHREAD_ONCE_INIT;
+
+static enum navigation_level navigation_supported(void)
+{
+#if NAVIGATION_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) return navigation_level_avx512;
+    if (__builtin_cpu_supports("avx2")) return navigation_level_avx2;
+#endif
+
+    return navigation_level_scalar;
+}
+
+enum navigation_level navigation_select(enum navigation_level level)
+{
+    enum navigation_level supported = navigation_supported();
+    if (level > supported) level = supported;
+
+    navigation_selected = &navigation_levels[level];
+
+    return level;
+}
+
+static void navigation_default(void)
+{
+    if (navigation_selected == NULL) navigation_select(navigation_level_avx512);
+}
+
+static const struct navigation_functions* navigation_functions(void)
+{
+    pthread_once(&navigation_once, navigation_default);
+    return navigation_selected;
+}
+
+static void summarize_block(const struct movement* array, size_t length, struct navigation* summary)
+{
+    size_t stride = length / NAVIGATION_LANES;
+    const struct movement* rest = array + NAVIGATION_LANES * stride;
+
+    struct navigation_lane lanes[NAVIGATION_LANES];
+    struct navigation_lane tail = {0, 0, 0, 0};
+
+    navigation_functions()->scan(array, stride, 1, stride, lanes);
+
+    for (size_t index = NAVIGATION_LANES * stride; index < length; ++index)
+    {
+        lane_step(&tail, array[index]);
+    }
+
+    for (size_t lane = 0; lane < NAVIGATION_LANES; ++lane)
+    {
+        merge_lane(summary, &lanes[lane], array + lane * stride, stride);
+    }
+
+    merge_lane(summary, &tail, rest, length - NAVIGATION_LANES * stride);
+}
+
+static void summarize_lanes(const struct movement* array, size_t length, struct navigation* summary)
+{
+    memset(summary, 0, sizeof(struct navigation));
+
+    for (size_t begin = 0; begin < length; begin += NAVIGATION_BLOCK)
+    {
+        size_t block = length - begin < NAVIGATION_BLOCK ? length - begin : NAVIGATION_BLOCK;
+        summarize_block(array + begin, block, summary);
+    }
+}
+
+struct position calculate_final_position(const struct movement* array, size_t length)
+{
+    struct navigation summary;
+    summarize_lanes(array, length, &summary);
+
+    return summary.position;
+}
+
+struct position calculate_final_position_with_aim(const struct movement* array, size_t length)
+{
+    struct navigation summary;
+    summarize_lanes(array, length, &summary);
+
+    return summary.position_with_aim;
+}
+
+void navigation_update(struct navigation* navigation, const struct movement* array, size_t length)
+{
+    struct navigation summary;
+    summarize_lanes(array, length, &summary);
+
+    navigation_merge(navigation, &summary);
+}
+
+int navigation_answers(const struct navigation* navigation, struct solver_answers* answers)
+{
+    __int128 answer_1;
+    __int128 answer_2;
+
+    const struct position* position_1 = &navigation->position;
+    const struct position* position_2 = &navigation->position_with_aim;
+
+    if (__builtin_mul_overflow(position_1->horizontal, position_1->depth, &answer_1) || __builtin_mul_overflow(position_2->horizontal, position_2->depth, &answer_2))
+    {
+        errno = ERANGE;
+        return -1;
+    }
+
+    solver_set_i128(answers, answer_1, answer_2);
+
+    return 0;
+}
+
+static void* navigation_range_main(void* argument)
+{
+    struct navigation_range* range = argument;
+    summarize_lanes(range->array, range->length, &range->summary);
+
+    return NULL;
+}
+
+int navigation_update_parallel(struct navigation* navigation, const struct movement* array, size_t length, size_t total_threads)
+{
+    if (total_threads > length / NAVIGATION_LANES) total_threads = length / NAVIGATION_LANES;
+
+    if (total_threads <= 1)
+    {
+        navigation_update(navigation, array, length);
+        return 0;
+    }
+
+    struct navigation_range* ranges = calloc(total_threads, sizeof(struct navigation_range));
+    if (ranges == NULL) return -1;
+
+    for (size_t index = 0; index < total_threads; ++index)
+    {
+        size_t begin = length * index / total_threads;
+        size_t end = length * (index + 1) / total_threads;
+
+        ranges[index].array = array + begin;
+        ranges[index].length = end - begin;
+    }
+
+    for (size_t index = 1; index < total_threads; ++index)
+    {
+        struct navigation_range* range = &ranges[index];
+
+        if (pthread_create(&range->thread, NULL, navigation_range_main, range) == 0) range->started = 1;
+        else navigation_range_main(range);
+    }
+
+    navigation_range_main(&ranges[0]);
+
+    for (size_t index = 0; index < total_threads; ++index)
+    {
+        if (ranges[index].started) pthread_join(ranges[index].thread, NULL);
+        navigation_merge(navigation, &ranges[index].summary);
+    }
+
+    free(ranges);
+
+    return 0;
+}
+
+int navigation_index_build(struct navigation_index* navigation_index, const struct movement* array, size_t length, size_t interval)
+{
+    navigation_index->array = array;
+    navigation_index->length = length;
+    navigation_index->interval = interval;
+
+    buffer_init(&navigation_index->checkpoints, sizeof(struct navigation));
+
+    if (interval == 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    struct buffer* checkpoints = &navigation_index->checkpoints;
+    if (buffer_reserve(checkpoints, length / interval + 1) == -1) return -1;
+
+    struct navigation navigation;
+    memset(&navigation, 0, sizeof(struct navigation));
+
+    for (size_t begin = 0; begin <= length; begin += interval)
+    {
+        struct navigation* checkpoint = buffer_push(checkpoints);
+        *checkpoint = navigation;
+
+        if (length - begin >= interval) navigation_update(&navigation, array + begin, interval);
+    }
+
+    return 0;
+}
+
+void navigation_index_free(struct navigation_index* navigation_index)
+{
+    buffer_free(&navigation_index->checkpoints);
+}
+
+int navigation_index_query(const struct navigation_index* navigation_index, size_t step, struct navigation* navigation)
+{
+    if (step > navigation_index->length)
+    {
+        errno = ERANGE;
+        return -1;
+    }
+
+    const struct navigation* checkpoints = navigation_index->checkpoints.data;
+
+    size_t checkpoint = step / navigation_index->interval;
+    size_t begin = checkpoint * navigation_index->interval;
+
+    *navigation = checkpoints[checkpoint];
+    navigation_update(navigation, navigation_index->array + begin, step - begin);
+
+    return 0;
+}
+
+int navigation_index_query_batch(const struct navigation_index* navigation_index, const size_t* steps, size_t total_steps, struct navigation* navigations)
+{
+    for (size_t index = 0; index < total_steps; ++index)
+    {
+        if (navigation_index_query(navigation_index, steps[index], &navigations[index]) == -1) return -1;
+    }
+
+    return 0;
+}
+
+static void fleet_group_wide(const struct movement* movements, size_t length, const size_t* scripts, struct navigation* navigations)
+{
+    for (size_t lane = 0; lane < FLEET_LANES; ++lane)
+    {
+        size_t script = scripts[lane];
+        if (script == SIZE_MAX) continue;
+
+        memset(&navigations[script], 0, sizeof(struct navigation));
+
+        for (size_t step = 0; step < length; ++step)
+        {
+            navigation_step(&navigations[script], movements[step * FLEET_LANES + lane]);
+        }
+    }
+}
+
+static int compare_fleet_entries(const void* a, const void* b)
+{
+    const struct fleet_entry* x = a;
+    const struct fleet_entry* y = b;
+
+    if (x->length != y->length) return x->length < y->length ? 1 : -1;
+    return x->script < y->script ? -1 : x->script > y->script;
+}
+
+int fleet_build(struct fleet* fleet, const struct movement* const* arrays, const size_t* lengths, size_t total_scripts)
+{
+    buffer_init(&fleet->movements, sizeof(struct movement));
+    buffer_init(&fleet->groups, sizeof(struct fleet_group));
+    buffer_init(&fleet->scripts, sizeof(size_t));
+
+    fleet->total_scripts = total_scripts;
+
+    size_t total_groups = (total_scripts + FLEET_LANES - 1) / FLEET_LANES;
+
+    struct fleet_entry* entries = malloc((total_scripts + 1) * sizeof(struct fleet_entry));
+    if (entries == NULL) return -1;
+
+    for (size_t script = 0; script < total_scripts; ++script)
+    {
+        entries[script].length = lengths[script];
+        entries[script].script = script;
+    }
+
+    qsort(entries, total_scripts, sizeof(struct fleet_entry), compare_fleet_entries);
+
+    size_t total_steps = 0;
+
+    for (size_t group = 0; group < total_groups; ++group)
+    {
+        total_steps += entries[group * FLEET_LANES].length;
+    }
+
+    int result = -1;
+
+    if (buffer_reserve(&fleet->movements, total_steps * FLEET_LANES) == -1) goto cleanup;
+    if (buffer_reserve(&fleet->groups, total_groups) == -1) goto cleanup;
+    if (buffer_reserve(&fleet->scripts, total_groups * FLEET_LANES) == -1) goto cleanup;
+
+    struct movement* movements = fleet->movements.data;
+    struct fleet_group* groups = fleet->groups.data;
+    size_t* scripts = fleet->scripts.data;
+
+    size_t offset = 0;
+
+    for (size_t group = 0; group < total_groups; ++group)
+    {
+        size_t length = entries[group * FLEET_LANES].length;
+
+        groups[group].offset = offset;
+        groups[group].length = length;
+        groups[group].wide = 0;
+
+        for (size_t lane = 0; lane < FLEET_LANES; ++lane)
+        {
+            size_t slot = group * FLEET_LANES + lane;
+
+            const struct movement* array = NULL;
+            size_t lane_length = 0;
+
+            scripts[slot] = SIZE_MAX;
+
+            if (slot < total_scripts)
+            {
+                scripts[slot] = entries[slot].script;
+
+                array = arrays[entries[slot].script];
+                lane_length = entries[slot].length;
+            }
+
+            uint64_t total = 0;
+
+            for (size_t step = 0; step < length; ++step)
+            {
+                struct movement movement = step < lane_length ? array[step] : movement_pack(direction_none, 0);
+
+                movements[offset + step * FLEET_LANES + lane] = movement;
+                total += movement_value(movement);
+            }
+
+            if (total >= NAVIGATION_LANE_LIMIT) groups[group].wide = 1;
+        }
+
+        offset += length * FLEET_LANES;
+    }
+
+    fleet->movements.length = offset;
+    fleet->groups.length = total_groups;
+    fleet->scripts.length = total_groups * FLEET_LANES;
+
+    result = 0;
+
+    cleanup: free(entries);
+
+    return result;
+}
+
+void fleet_free(struct fleet* fleet)
+{
+    buffer_free(&fleet->movements);
+    buffer_free(&fleet->groups);
+    buffer_free(&fleet->scripts);
+}
+
+void fleet_solve(const struct fleet* fleet, struct navigation* navigations)
+{
+    const struct navigation_functions* functions = navigation_functions();
+
+    const struct movement* movements = fleet->movements.data;
+    const struct fleet_group* groups = fleet->groups.data;
+    const size_t* scripts = fleet->scripts.data;
+
+    struct navigation_lane lanes[FLEET_LANES];
+
+    for (size_t group = 0; group < fleet->groups.length; ++group)
+    {
+        if (groups[group].wide)
+        {
+            fleet_group_wide(movements + groups[group].offset, groups[group].length, scripts + group * FLEET_LANES, navigations);
+            continue;
+        }
+
+        functions->scan(movements + groups[group].offset, groups[group].length, FLEET_LANES, 1, lanes);
+
+        for (size_t lane = 0; lane < FLEET_LANES; ++lane)
+        {
+            size_t script = scripts[group * FLEET_LANES + lane];
+            if (script == SIZE_MAX) continue;
+
+            memset(&navigations[script], 0, sizeof(struct navigation));
+            lane_merge(&navigations[script], &lanes[lane]);
+        }
+    }
+}
+
+void challenge_2_init(struct challenge_2_workspace* workspace)
+{
+    buffer_init(&workspace->array, sizeof(struct movement));
+
+    workspace->total_threads = 1;
+    workspace->stats = NULL;
+}
+
+void challenge_2_free(struct challenge_2_workspace* workspace)
+{
+    buffer_free(&workspace->array);
+}
+
+int challenge_2_parse(const struct input* input, const size_t* hints, struct challenge_2_workspace* workspace)
+{
+    struct buffer* array = &workspace->array;
+    buffer_clear(array);
+
+    if (buffer_reserve(array, hints[0]) == -1) return -1;
+    return read_input(input, array);
+}
+
+int challenge_2_finish(struct challenge_2_workspace* workspace, const size_t* hints, struct solver_answers* answers)
+{
+    (void) hints;
+
+    struct buffer* array = &workspace->array;
+
+    struct navigation navigation;
+    memset(&navigation, 0, sizeof(struct navigation));
+
+    if (navigation_update_parallel(&navigation, array->data, array->length, workspace->total_threads) == -1) return -1;
+
+    return navigation_answers(&navigation, answers);
+}
+
+int challenge_2_load(const struct cache* cache, struct challenge_2_workspace* workspace)
+{
+    if (cache->section_sizes[0] % sizeof(struct movement) != 0)
+    {
+        errno = ESTALE;
+        return -1;
+    }
+
+    size_t length_0 = cache->section_sizes[0] / sizeof(struct movement);
+
+    buffer_clear(&workspace->array);
+    if (buffer_reserve(&workspace->array, length_0) == -1) return -1;
+
+    memcpy(workspace->array.data, cache->sections[0], cache->section_sizes[0]);
+    workspace->array.length = length_0;
+
+    return 0;
+}
+
+int challenge_2_store(const char* name, const struct challenge_2_workspace* workspace)
+{
+    uint64_t params[CACHE_PARAMS] = {0};
+
+    const void* sections[CACHE_SECTIONS] = {workspace->array.data, NULL};
+    size_t section_sizes[CACHE_SECTIONS] = {workspace->array.length * sizeof(struct movement), 0};
+
+    return cache_write(name, 2, params, sections, section_sizes);
+}
+
+int challenge_2_solve(const struct input* input, const size_t* hints, struct challenge_2_workspace* workspace, struct solver_answers* answers)
+{
+    stats_begin(workspace->stats);
+    if (challenge_2_parse(input, hints, workspace) == -1) return -1;
+
+    stats_end(workspace->stats, stats_parse);
+
+    int result = challenge_2_finish(workspace, hints, answers);
+    stats_end(workspace->stats, stats_solve);
+
+    return result;
+}
+
+static void init_workspace(void* workspace)
+{
+    challenge_2_init(workspace);
+}
+
+static void free_workspace(void* workspace)
+{
+    challenge_2_free(workspace);
+}
+
+static int solve_input(const struct input* input, const size_t* hints, void* workspace, struct solver_answers* answers)
+{
+    return challenge_2_solve(input, hints, workspace, answers);
+}
+
+const struct solver challenge_2_solver = {"2", sizeof(struct challenge_2_workspace), init_workspace, free_workspace, solve_input};
@@ -0,0 +1,134 @@
+#ifndef CHALLENGE_2_H
+#define CHALLENGE_2_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+enum direction
+{
+    direction_none = 0,
+    direction_forward = 1,
+    direction_up = 2,
+    direction_down = 3,
+};
+
+#define MOVEMENT_DIRECTION_BITS 2
+#define MOVEMENT_MAX_VALUE (UINT32_MAX >> MOVEMENT_DIRECTION_BITS)
+
+struct movement
+{
+    uint32_t packed;
+};
+
+struct position
+{
+    __int128 horizontal;
+    __int128 depth;
+};
+
+struct navigation
+{
+    struct position position;
+    struct position position_with_aim;
+
+    __int128 aim;
+};
+
+static inline struct movement movement_pack(enum direction direction, uint32_t value)
+{
+    struct movement movement = {value << MOVEMENT_DIRECTION_BITS | direction};
+    return movement;
+}
+
+static inline enum direction movement_direction(struct movement movement)
+{
+    return movement.packed & ((1 << MOVEMENT_DIRECTION_BITS) - 1);
+}
+
+static inline uint32_t movement_value(struct movement movement)
+{
+    return movement.packed >> MOVEMENT_DIRECTION_BITS;
+}
+
+#define NAVIGATION_LANES 8
+
+enum navigation_level
+{
+    navigation_level_scalar = 0,
+    navigation_level_avx2 = 1,
+    navigation_level_avx512 = 2,
+};
+
+#define NAVIGATION_INTERVAL 1024
+
+struct navigation_index
+{
+    const struct movement* array;
+    size_t length;
+
+    size_t interval;
+    struct buffer checkpoints;
+};
+
+#define FLEET_LANES NAVIGATION_LANES
+
+struct fleet_group
+{
+    size_t offset;
+    size_t length;
+
+    int wide;
+};
+
+struct fleet
+{
+    struct buffer movements;
+    struct buffer groups;
+    struct buffer scripts;
+
+    size_t total_scripts;
+};
+
+struct challenge_2_workspace
+{
+    struct buffer array;
+    size_t total_threads;
+
+    struct stats* stats;
+};
+
+extern const struct solver challenge_2_solver;
+
+int challenge_2_read(const char* str, const char* last, struct buffer* array);
+struct position calculate_final_position(const struct movement* array, size_t length);
+struct position calculate_final_position_with_aim(const struct movement* array, size_t length);
+void navigation_merge(struct navigation* navigation, const struct navigation* next);
+void navigation_update(struct navigation* navigation, const struct movement* array, size_t length);
+int navigation_answers(const struct navigation* navigation, struct solver_answers* answers);
+int navigation_update_parallel(struct navigation* navigation, const struct movement* array, size_t length, size_t total_threads);
+enum navigation_level navigation_select(enum navigation_level level);
+
+int navigation_index_build(struct navigation_index* navigation_index, const struct movement* array, size_t length, size_t interval);
+void navigation_index_free(struct navigation_index* navigation_index);
+int navigation_index_query(const struct navigation_index* navigation_index, size_t step, struct navigation* navigation);
+int navigation_index_query_batch(const struct navigation_index* navigation_index, const size_t* steps, size_t total_steps, struct navigation* navigations);
+
+int fleet_build(struct fleet* fleet, const struct movement* const* arrays, const size_t* lengths, size_t total_scripts);
+void fleet_free(struct fleet* fleet);
+void fleet_solve(const struct fleet* fleet, struct navigation* navigations);
+
+void challenge_2_init(struct challenge_2_workspace* workspace);
+void challenge_2_free(struct challenge_2_workspace* workspace);
+int challenge_2_parse(const struct input* input, const size_t* hints, struct challenge_2_workspace* workspace);
+int challenge_2_finish(struct challenge_2_workspace* workspace, const size_t* hints, struct solver_answers* answers);
+int challenge_2_load(const struct cache* cache, struct challenge_2_workspace* workspace);
+int challenge_2_store(const char* name, const struct challenge_2_workspace* workspace);
+int challenge_2_solve(const struct input* input, const size_t* hints, struct challenge_2_workspace* workspace, struct solver_answers* answers);
+
+#endif
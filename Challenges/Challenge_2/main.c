@@ -1,214 +1,393 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <inttypes.h>
-#include <ctype.h>
 #include <string.h>
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 #include <unistd.h>
-#include <fcntl.h>
-#include <sys/types.h>
-#include <sys/stat.h>
 
-enum direction
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/stream.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+#include "challenge_2.h"
+
+struct stream_context
 {
-    direction_none = 0,
-    direction_forward = 1,
-    direction_up = 2,
-    direction_down = 3,
+    struct buffer batch;
+    struct navigation navigation;
+
+    struct stats* stats;
 };
 
-struct movement
+static const char* consume_chunk(const char* str, const char* last, int final, void* context)
 {
-    enum direction direction;
-    uint64_t value;
-};
+    struct stream_context* c = context;
+    const char* end = final ? last : stream_split(str, last, '\n');
+
+    stats_end(c->stats, stats_read);
+
+    buffer_clear(&c->batch);
+    if (challenge_2_read(str, end, &c->batch) == -1) return NULL;
+
+    stats_end(c->stats, stats_parse);
+
+    navigation_update(&c->navigation, c->batch.data, c->batch.length);
+    stats_end(c->stats, stats_solve);
+
+    return end;
+}
+
+static int solve_stream(const char* name, struct stats* stats, struct solver_answers* answers)
+{
+    int file = stream_open(name);
+    if (file == -1) return -1;
+
+    struct stream_context context;
+    memset(&context, 0, sizeof(struct stream_context));
 
-struct position
+    buffer_init(&context.batch, sizeof(struct movement));
+
+    context.stats = stats;
+    stats_begin(stats);
+
+    int result = stream_run(file, consume_chunk, &context);
+
+    if (result != -1) result = navigation_answers(&context.navigation, answers);
+
+    buffer_free(&context.batch);
+    stream_close(file);
+
+    return result;
+}
+
+struct fleet_script
 {
-    int64_t horizontal;
-    int64_t depth;
+    const char* path;
+    struct buffer array;
+
+    int error;
 };
 
-void skip_space(char* str, char** end)
+static int is_blank(char c)
 {
-    char* a = *end;
+    return c == ' ' || c == '\t' || c == '\r';
+}
 
-    while (str != a)
+static int read_fleet(char* str, char* last, struct buffer* scripts)
+{
+    while (str < last)
     {
-        if (!isspace(*str)) break;
-        str += 1;
+        char* line_end = memchr(str, '\n', last - str);
+        if (line_end == NULL) line_end = last;
+
+        char* a = str;
+        char* b = line_end;
+
+        str = line_end + 1;
+
+        while (a != b && is_blank(*a)) ++a;
+        while (b != a && is_blank(b[-1])) --b;
+
+        if (a == b || *a == '#') continue;
+
+        struct fleet_script* script = buffer_push(scripts);
+        if (script == NULL) return -1;
+
+        *b = '\0';
+
+        script->path = a;
+        script->error = 0;
+
+        buffer_init(&script->array, sizeof(struct movement));
     }
 
-    *end = str;
+    return 0;
 }
 
-void skip_alpha(char* str, char** end)
+static void load_script(struct fleet_script* script)
 {
-    char* a = *end;
+    struct input input;
 
-    while (str != a)
+    if (input_open(script->path, &input) == -1)
     {
-        if (!isalpha(*str)) break;
-        str += 1;
+        script->error = errno;
+        return;
     }
 
-    *end = str;
+    if (challenge_2_read(input.begin, input.end, &script->array) == -1)
+    {
+        script->error = errno;
+        buffer_clear(&script->array);
+    }
+
+    input_close(&input);
 }
 
-int read_input(const char* name, struct movement* array, size_t* length)
+static int solve_fleet(const char* name, size_t* failures)
 {
-    int file = -1;
-    char* mem = NULL;
-    
-    file = open(name, O_RDONLY);
-    if (file == -1) goto cleanup;
+    int result = -1;
 
-    struct stat64 stat;
-    fstat64(file, &stat);
+    struct buffer list;
+    struct buffer scripts;
 
-    mem = malloc(stat.st_size + 1);
-    if (mem == NULL) goto cleanup;
+    buffer_init(&list, sizeof(char));
+    buffer_init(&scripts, sizeof(struct fleet_script));
 
-    size_t mem_index = 0;
-    size_t mem_remaining = stat.st_size;
+    struct fleet fleet;
+    memset(&fleet, 0, sizeof(struct fleet));
 
-    while (mem_remaining != 0)
-    {
-        ssize_t chars = read(file, mem + mem_index, mem_remaining);
-        if (chars == -1) goto cleanup;
+    const struct movement** arrays = NULL;
+    size_t* lengths = NULL;
+    struct navigation* navigations = NULL;
 
-        mem_index += chars;
-        mem_remaining -= chars;
-    }
-    
-    char* last = mem + mem_index;
-    *last = 0;
+    if (stream_slurp(name, &list) == -1) goto cleanup;
 
-    char* str = mem;
+    char* str = list.data;
+    if (read_fleet(str, str + list.length, &scripts) == -1) goto cleanup;
 
-    size_t index = 0;
-    size_t max_length = *length;
+    struct fleet_script* script = scripts.data;
+    size_t total_scripts = scripts.length;
 
-    while (index < max_length)
+    arrays = malloc((total_scripts + 1) * sizeof(const struct movement*));
+    lengths = malloc((total_scripts + 1) * sizeof(size_t));
+    navigations = malloc((total_scripts + 1) * sizeof(struct navigation));
+
+    if (arrays == NULL || lengths == NULL || navigations == NULL) goto cleanup;
+
+    for (size_t index = 0; index < total_scripts; ++index)
     {
-        char* end;
+        load_script(&script[index]);
+
+        arrays[index] = script[index].array.data;
+        lengths[index] = script[index].array.length;
+    }
 
-        end = last;
-        skip_space(str, &end);
+    if (fleet_build(&fleet, arrays, lengths, total_scripts) == -1) goto cleanup;
+    fleet_solve(&fleet, navigations);
 
-        str = end;
+    for (size_t index = 0; index < total_scripts; ++index)
+    {
+        if (script[index].error != 0)
+        {
+            printf("SCRIPT %s: error %s\n", script[index].path, strerror(script[index].error));
+            *failures += 1;
+            continue;
+        }
 
-        end = last;
-        skip_alpha(str, &end);
+        struct solver_answers answers;
 
-        size_t diff = end - str;
-        enum direction direction = direction_none;
+        if (navigation_answers(&navigations[index], &answers) == -1)
+        {
+            printf("SCRIPT %s: error %s\n", script[index].path, strerror(errno));
+            *failures += 1;
+            continue;
+        }
 
-        if (!strncmp(str, "forward", diff)) direction = direction_forward;
-        if (!strncmp(str, "up", diff)) direction = direction_up;
-        if (!strncmp(str, "down", diff)) direction = direction_down;
-        
-        str = end;
+        printf("SCRIPT %s: %s %s\n", script[index].path, answers.part_1, answers.part_2);
+    }
 
-        end = last;
-        uint64_t value = strtoull(str, &end, 10);
-        
-        struct movement movement;
-        
-        movement.direction = direction;
-        movement.value = value;
+    result = 0;
 
-        if (str != end) array[index++] = movement;
-        if (str == last) break;
-        
-        str = end;
+    cleanup: fleet_free(&fleet);
+
+    for (size_t index = 0; index < scripts.length; ++index)
+    {
+        buffer_free(&((struct fleet_script*) scripts.data)[index].array);
     }
-    
-    *length = index;
-    
-    cleanup: if (file != -1) close(file);
-    if (mem != NULL) free(mem);
-    
-    return file;
+
+    if (arrays != NULL) free(arrays);
+    if (lengths != NULL) free(lengths);
+    if (navigations != NULL) free(navigations);
+
+    buffer_free(&list);
+    buffer_free(&scripts);
+
+    return result;
 }
 
-struct position calculate_final_position(const struct movement* array, size_t length)
+static int print_steps(const struct challenge_2_workspace* workspace, const struct buffer* steps, size_t interval)
 {
-    struct position current_position = {0, 0};
+    int result = -1;
 
-    for (size_t index = 0; index < length; ++index)
-    {
-        struct movement movement = array[index];
+    const size_t* step = steps->data;
 
-        enum direction direction = movement.direction;
-        uint64_t value = movement.value;
+    struct navigation_index navigation_index;
+    struct buffer navigations;
 
-        struct position offset = {0, 0};
+    buffer_init(&navigations, sizeof(struct navigation));
 
-        switch (direction)
+    if (navigation_index_build(&navigation_index, workspace->array.data, workspace->array.length, interval) == -1) goto cleanup;
+    if (buffer_reserve(&navigations, steps->length) == -1) goto cleanup;
+
+    struct navigation* navigation = navigations.data;
+    if (navigation_index_query_batch(&navigation_index, step, steps->length, navigation) == -1) goto cleanup;
+
+    for (size_t index = 0; index < steps->length; ++index)
+    {
+        __int128 values[5] =
         {
-            case direction_forward: offset.horizontal += value; break;
-            case direction_up: offset.depth -= value; break;
-            case direction_down: offset.depth += value; break;
+            navigation[index].position.horizontal,
+            navigation[index].position.depth,
+            navigation[index].position_with_aim.horizontal,
+            navigation[index].position_with_aim.depth,
+            navigation[index].aim,
+        };
+
+        char fields[5][SOLVER_ANSWER_SIZE];
+
+        for (size_t field = 0; field < 5; ++field)
+        {
+            solver_format_i128(fields[field], SOLVER_ANSWER_SIZE, values[field]);
         }
 
-        current_position.horizontal += offset.horizontal;
-        current_position.depth += offset.depth;
+        printf("STEP %zu: %s %s %s %s %s\n", step[index], fields[0], fields[1], fields[2], fields[3], fields[4]);
     }
-    
-    return current_position;
+
+    result = 0;
+
+    cleanup: navigation_index_free(&navigation_index);
+    buffer_free(&navigations);
+
+    return result;
 }
 
-struct position calculate_final_position_with_aim(const struct movement* array, size_t length)
+int main(int argc, char** argv)
 {
-    struct position current_position = {0, 0};
-    int64_t aim = 0;
+    struct stats stats;
+    struct stats* active_stats = NULL;
+
+    int write_cache = solver_flag(&argc, argv, "--cache");
+    size_t total_threads = solver_option(&argc, argv, "--threads", sysconf(_SC_NPROCESSORS_ONLN));
+    size_t interval = solver_option(&argc, argv, "--interval", NAVIGATION_INTERVAL);
+    const char* steps = solver_argument(&argc, argv, "--steps");
+    int fleet = solver_flag(&argc, argv, "--fleet");
+
+    if (solver_flag(&argc, argv, "--stats"))
+    {
+        stats_init(&stats);
+        active_stats = &stats;
+    }
+
+    if (argc < 2) return EXIT_FAILURE;
+
+    size_t hints[SOLVER_MAX_HINTS];
+    solver_parse_hints(argc - 2, argv + 2, hints);
+
+    struct solver_answers answers;
+
+    struct challenge_2_workspace workspace;
+    challenge_2_init(&workspace);
+
+    workspace.total_threads = total_threads;
+
+    struct buffer step_list;
+    buffer_init(&step_list, sizeof(size_t));
+
+    int status = EXIT_SUCCESS;
+    int result = 0;
+
+    if (steps != NULL && solver_parse_list(steps, &step_list) == -1)
+    {
+        perror("Failed to read steps");
+        status = EXIT_FAILURE;
+        goto cleanup;
+    }
+
+    if (steps != NULL && (fleet || stream_wanted(argv[1])))
+    {
+        errno = EINVAL;
 
-    for (size_t index = 0; index < length; ++index)
+        perror("Steps need a mapped input");
+        status = EXIT_FAILURE;
+        goto cleanup;
+    }
+
+    if (fleet)
+    {
+        size_t failures = 0;
+
+        if (solve_fleet(argv[1], &failures) == -1)
+        {
+            perror("Failed to read fleet");
+            status = EXIT_FAILURE;
+        }
+
+        if (failures != 0) status = EXIT_FAILURE;
+        goto cleanup;
+    }
+
+    if (stream_wanted(argv[1]))
+    {
+        if (solve_stream(argv[1], active_stats, &answers) == -1)
+        {
+            perror("Failed to read input stream");
+            status = EXIT_FAILURE;
+            goto cleanup;
+        }
+    }
+    else
     {
-        struct movement movement = array[index];
+        struct cache cache;
+        struct input input;
 
-        enum direction direction = movement.direction;
-        uint64_t value = movement.value;
+        stats_begin(active_stats);
 
-        switch (direction)
+        if (cache_open(argv[1], 2, &cache) == 0)
         {
-            case direction_up: aim -= value; break;
-            case direction_down: aim += value; break;
+            stats_end(active_stats, stats_read);
+
+            result = challenge_2_load(&cache, &workspace);
+            cache_close(&cache);
         }
-        
-        if (direction == direction_forward)
+        else
         {
-            current_position.horizontal += value;
-            current_position.depth += aim * value;
+            if (input_open(argv[1], &input) == -1)
+            {
+                perror("Failed to read input file");
+                status = EXIT_FAILURE;
+                goto cleanup;
+            }
+
+            stats_end(active_stats, stats_read);
+
+            result = challenge_2_parse(&input, hints, &workspace);
+            input_close(&input);
+
+            if (result != -1 && write_cache && challenge_2_store(argv[1], &workspace) == -1) perror("Failed to write cache");
+        }
+
+        stats_end(active_stats, stats_parse);
+
+        if (result != -1) result = challenge_2_finish(&workspace, hints, &answers);
+        stats_end(active_stats, stats_solve);
+
+        if (result == -1)
+        {
+            perror("Failed to parse input file");
+            status = EXIT_FAILURE;
+            goto cleanup;
         }
     }
-    
-    return current_position;
-}
 
-int main(int argc, char** argv)
-{
-    if (argc < 3) return EXIT_FAILURE;
-    
-    size_t length = strtoull(argv[2], NULL, 10);
-    struct movement* array = malloc(length * sizeof(struct movement));
+    solver_print(&answers);
 
-    if (read_input(argv[1], array, &length) == -1)
+    if (step_list.length != 0 && print_steps(&workspace, &step_list, interval) == -1)
     {
-        perror("Failed to read input file");
-        return EXIT_FAILURE;
+        perror("Failed to query steps");
+        status = EXIT_FAILURE;
     }
-    
-    struct position final_position_1 = calculate_final_position(array, length);
-    struct position final_position_2 = calculate_final_position_with_aim(array, length);
 
-    printf("ANSWER PART I: %" PRId64 "\n", final_position_1.horizontal * final_position_1.depth);
-    printf("ANSWER PART II: %" PRId64 "\n", final_position_2.horizontal * final_position_2.depth);
-    
-    free(array);
+    if (active_stats != NULL) stats_print(active_stats, 2);
+
+    cleanup: challenge_2_free(&workspace);
+    buffer_free(&step_list);
+    if (active_stats != NULL) stats_free(active_stats);
 
-    return EXIT_SUCCESS;
+    return status;
 }
@@ -0,0 +1,1474 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <ctype.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define COLUMN_X86 1
+#else
+#define COLUMN_X86 0
+#endif
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+#include "challenge_3.h"
+
+#define COLUMN_BLOCK 16
+#define COLUMN_BYTES 8
+#define COLUMN_BYTE_LIMIT 255
+#define COLUMN_BYTE_MASK UINT64_C(0x0101010101010101)
+#define COLUMN_NARROW 2
+#define COLUMN_SHORT 4096
+
+#define ROW_DIGIT_MASK UINT64_C(0x0101010101010101)
+#define ROW_DIGIT_GATHER UINT64_C(0x8040201008040201)
+#define ROW_DIGIT_ZEROS UINT64_C(0x3030303030303030)
+
+#define MATRIX_BLOCK 64
+#define MATRIX_LINE 8
+#define MATRIX_PAGE 512
+#define MATRIX_SPARSE 8
+#define MATRIX_THREAD_WORDS 4096
+
+struct column_functions
+{
+    void (*sliced)(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns);
+};
+
+struct column_range
+{
+    pthread_t thread;
+    int started;
+
+    const uint64_t* array;
+    size_t length;
+
+    size_t column_offset;
+    size_t total_columns;
+
+    uint64_t column_counts[64];
+};
+
+struct matrix_range
+{
+    pthread_t thread;
+    int started;
+
+    struct bit_matrix* matrix;
+
+    const uint64_t* rows;
+    size_t row_words;
+
+    size_t begin;
+    size_t end;
+
+    uint64_t* column_counts;
+};
+
+static void skip_space(const char* str, const char** end)
+{
+    const char* a = *end;
+
+    while (str != a)
+    {
+        if (!isspace(*str)) break;
+        str += 1;
+    }
+
+    *end = str;
+}
+
+static size_t row_words(size_t total_columns)
+{
+    return total_columns > 64 ? (total_columns + 63) / 64 : 1;
+}
+
+static uint64_t read_digits(const char* str, size_t length)
+{
+    uint64_t value = 0;
+    size_t index = 0;
+
+    for (; index + 8 <= length; index += 8)
+    {
+        uint64_t chunk;
+        memcpy(&chunk, str + index, sizeof(uint64_t));
+
+        value = value << 8 | ((chunk & ROW_DIGIT_MASK) * ROW_DIGIT_GATHER) >> 56;
+    }
+
+    for (; index < length; ++index)
+    {
+        value = value << 1 | (uint64_t) (str[index] - '0');
+    }
+
+    return value;
+}
+
+static const char* skip_digits(const char* str, const char* last)
+{
+    while (last - str >= 8)
+    {
+        uint64_t chunk;
+        memcpy(&chunk, str, sizeof(uint64_t));
+
+        if ((chunk & ~ROW_DIGIT_MASK) != ROW_DIGIT_ZEROS) break;
+        str += 8;
+    }
+
+    while (str != last && (*str == '0' || *str == '1')) str += 1;
+
+    return str;
+}
+
+static int widen_rows(struct buffer* array, size_t from_words, size_t to_words)
+{
+    size_t length = array->length / from_words;
+    size_t capacity;
+
+    if (__builtin_mul_overflow(length, to_words, &capacity))
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    if (buffer_reserve(array, capacity) == -1) return -1;
+
+    uint64_t* words = array->data;
+
+    for (size_t row_index = length; row_index-- > 0;)
+    {
+        memmove(&words[row_index * to_words], &words[row_index * from_words], from_words * sizeof(uint64_t));
+        memset(&words[row_index * to_words + from_words], 0, (to_words - from_words) * sizeof(uint64_t));
+    }
+
+    array->length = capacity;
+
+    return 0;
+}
+
+static int push_row(struct buffer* array, const char* str, const char* end, size_t words)
+{
+    while (array->capacity - array->length < words)
+    {
+        if (buffer_grow(array) == -1) return -1;
+    }
+
+    uint64_t* row = (uint64_t*) array->data + array->length;
+    array->length += words;
+
+    for (size_t word = 0; word < words; ++word)
+    {
+        size_t digits = end - str < 64 ? (size_t) (end - str) : 64;
+
+        row[word] = read_digits(end - digits, digits);
+        end -= digits;
+    }
+
+    return 0;
+}
+
+int challenge_3_read(const char* str, const char* last, struct buffer* array, size_t* total_columns)
+{
+    size_t max_columns = *total_columns;
+    size_t words = row_words(max_columns);
+
+    while (str != last)
+    {
+        const char* end;
+
+        end = last;
+        skip_space(str, &end);
+
+        str = end;
+        if (str == last) break;
+
+        end = skip_digits(str, last);
+
+        if (str == end)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+
+        size_t columns = end - str;
+
+        if (columns > max_columns)
+        {
+            if (row_words(columns) > words)
+            {
+                if (widen_rows(array, words, row_words(columns)) == -1) return -1;
+                words = row_words(columns);
+            }
+
+            max_columns = columns;
+            *total_columns = max_columns;
+        }
+
+        if (push_row(array, str, end, words) == -1) return -1;
+
+        str = end;
+    }
+
+    return 0;
+}
+
+static int read_input(const struct input* input, struct buffer* array, size_t* total_columns)
+{
+    *total_columns = 0;
+    return challenge_3_read(input->begin, input->end, array, total_columns);
+}
+
+static void count_ones_narrow(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    for (size_t column_index = 0; column_index < total_columns; ++column_index)
+    {
+        size_t shift = column_offset + column_index;
+        if (shift >= 64) break;
+
+        uint64_t count = 0;
+
+        for (size_t row_index = 0; row_index < length; ++row_index)
+        {
+            count += (array[row_index] >> shift) & 1;
+        }
+
+        column_counts[column_index] += count;
+    }
+}
+
+static inline void carry_save_add(uint64_t* high, uint64_t* low, uint64_t a, uint64_t b)
+{
+    uint64_t sum = *low ^ a;
+
+    *high = (*low & a) | (sum & b);
+    *low = sum ^ b;
+}
+
+static inline uint64_t add_block(const uint64_t* row, uint64_t* ones, uint64_t* twos, uint64_t* fours, uint64_t* eights)
+{
+    uint64_t twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+
+    carry_save_add(&twos_a, ones, row[0], row[1]);
+    carry_save_add(&twos_b, ones, row[2], row[3]);
+    carry_save_add(&fours_a, twos, twos_a, twos_b);
+    carry_save_add(&twos_a, ones, row[4], row[5]);
+    carry_save_add(&twos_b, ones, row[6], row[7]);
+    carry_save_add(&fours_b, twos, twos_a, twos_b);
+    carry_save_add(&eights_a, fours, fours_a, fours_b);
+
+    carry_save_add(&twos_a, ones, row[8], row[9]);
+    carry_save_add(&twos_b, ones, row[10], row[11]);
+    carry_save_add(&fours_a, twos, twos_a, twos_b);
+    carry_save_add(&twos_a, ones, row[12], row[13]);
+    carry_save_add(&twos_b, ones, row[14], row[15]);
+    carry_save_add(&fours_b, twos, twos_a, twos_b);
+    carry_save_add(&eights_b, fours, fours_a, fours_b);
+
+    carry_save_add(&sixteens, eights, eights_a, eights_b);
+
+    return sixteens;
+}
+
+static void add_column_bits(uint64_t word, uint64_t weight, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    word >>= column_offset;
+
+    for (size_t column_index = 0; column_index < total_columns; ++column_index)
+    {
+        column_counts[column_index] += (word & 1) * weight;
+        word >>= 1;
+    }
+}
+
+static void flush_bytes(uint64_t* bytes, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    for (size_t column_index = 0; column_index < total_columns; ++column_index)
+    {
+        size_t column = column_offset + column_index;
+        uint64_t count = (bytes[column % COLUMN_BYTES] >> (column / COLUMN_BYTES * 8)) & 0xff;
+
+        column_counts[column_index] += count * COLUMN_BLOCK;
+    }
+
+    memset(bytes, 0, COLUMN_BYTES * sizeof(uint64_t));
+}
+
+static void count_ones_sliced(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    uint64_t ones = 0;
+    uint64_t twos = 0;
+    uint64_t fours = 0;
+    uint64_t eights = 0;
+
+    uint64_t bytes[COLUMN_BYTES] = {0};
+    size_t blocks = 0;
+
+    size_t row_index = 0;
+
+    for (; row_index + COLUMN_BLOCK <= length; row_index += COLUMN_BLOCK)
+    {
+        uint64_t sixteens = add_block(&array[row_index], &ones, &twos, &fours, &eights);
+
+        for (size_t byte = 0; byte < COLUMN_BYTES; ++byte)
+        {
+            bytes[byte] += (sixteens >> byte) & COLUMN_BYTE_MASK;
+        }
+
+        blocks += 1;
+
+        if (blocks == COLUMN_BYTE_LIMIT)
+        {
+            flush_bytes(bytes, column_offset, column_counts, total_columns);
+            blocks = 0;
+        }
+    }
+
+    flush_bytes(bytes, column_offset, column_counts, total_columns);
+
+    add_column_bits(eights, 8, column_offset, column_counts, total_columns);
+    add_column_bits(fours, 4, column_offset, column_counts, total_columns);
+    add_column_bits(twos, 2, column_offset, column_counts, total_columns);
+    add_column_bits(ones, 1, column_offset, column_counts, total_columns);
+
+    for (; row_index < length; ++row_index)
+    {
+        add_column_bits(array[row_index], 1, column_offset, column_counts, total_columns);
+    }
+}
+
+static void add_lane_bits(const uint64_t* lanes, size_t total_lanes, uint64_t weight, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    for (size_t lane = 0; lane < total_lanes; ++lane)
+    {
+        add_column_bits(lanes[lane], weight, column_offset, column_counts, total_columns);
+    }
+}
+
+static void flush_lane_bytes(const uint64_t* lanes, size_t total_lanes, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    for (size_t lane = 0; lane < total_lanes; ++lane)
+    {
+        uint64_t bytes[COLUMN_BYTES];
+
+        for (size_t byte = 0; byte < COLUMN_BYTES; ++byte)
+        {
+            bytes[byte] = lanes[byte * total_lanes + lane];
+        }
+
+        flush_bytes(bytes, column_offset, column_counts, total_columns);
+    }
+}
+
+#if COLUMN_X86
+
+__attribute__((target("avx2")))
+static inline void carry_save_add_avx2(__m256i* high, __m256i* low, __m256i a, __m256i b)
+{
+    __m256i sum = _mm256_xor_si256(*low, a);
+
+    *high = _mm256_or_si256(_mm256_and_si256(*low, a), _mm256_and_si256(sum, b));
+    *low = _mm256_xor_si256(sum, b);
+}
+
+__attribute__((target("avx2")))
+static void flush_bytes_avx2(__m256i* bytes, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    uint64_t lanes[COLUMN_BYTES * 4];
+
+    for (size_t byte = 0; byte < COLUMN_BYTES; ++byte)
+    {
+        _mm256_storeu_si256((__m256i*) &lanes[byte * 4], bytes[byte]);
+        bytes[byte] = _mm256_setzero_si256();
+    }
+
+    flush_lane_bytes(lanes, 4, column_offset, column_counts, total_columns);
+}
+
+__attribute__((target("avx2")))
+static void count_ones_avx2(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    __m256i mask = _mm256_set1_epi64x(COLUMN_BYTE_MASK);
+
+    __m256i ones = _mm256_setzero_si256();
+    __m256i twos = _mm256_setzero_si256();
+    __m256i fours = _mm256_setzero_si256();
+    __m256i eights = _mm256_setzero_si256();
+
+    __m256i bytes[COLUMN_BYTES];
+
+    for (size_t byte = 0; byte < COLUMN_BYTES; ++byte)
+    {
+        bytes[byte] = _mm256_setzero_si256();
+    }
+
+    size_t blocks = 0;
+    size_t row_index = 0;
+
+    for (; row_index + COLUMN_BLOCK * 4 <= length; row_index += COLUMN_BLOCK * 4)
+    {
+        const __m256i* row = (const __m256i*) &array[row_index];
+
+        __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+
+        carry_save_add_avx2(&twos_a, &ones, _mm256_loadu_si256(&row[0]), _mm256_loadu_si256(&row[1]));
+        carry_save_add_avx2(&twos_b, &ones, _mm256_loadu_si256(&row[2]), _mm256_loadu_si256(&row[3]));
+        carry_save_add_avx2(&fours_a, &twos, twos_a, twos_b);
+        carry_save_add_avx2(&twos_a, &ones, _mm256_loadu_si256(&row[4]), _mm256_loadu_si256(&row[5]));
+        carry_save_add_avx2(&twos_b, &ones, _mm256_loadu_si256(&row[6]), _mm256_loadu_si256(&row[7]));
+        carry_save_add_avx2(&fours_b, &twos, twos_a, twos_b);
+        carry_save_add_avx2(&eights_a, &fours, fours_a, fours_b);
+
+        carry_save_add_avx2(&twos_a, &ones, _mm256_loadu_si256(&row[8]), _mm256_loadu_si256(&row[9]));
+        carry_save_add_avx2(&twos_b, &ones, _mm256_loadu_si256(&row[10]), _mm256_loadu_si256(&row[11]));
+        carry_save_add_avx2(&fours_a, &twos, twos_a, twos_b);
+        carry_save_add_avx2(&twos_a, &ones, _mm256_loadu_si256(&row[12]), _mm256_loadu_si256(&row[13]));
+        carry_save_add_avx2(&twos_b, &ones, _mm256_loadu_si256(&row[14]), _mm256_loadu_si256(&row[15]));
+        carry_save_add_avx2(&fours_b, &twos, twos_a, twos_b);
+        carry_save_add_avx2(&eights_b, &fours, fours_a, fours_b);
+
+        carry_save_add_avx2(&sixteens, &eights, eights_a, eights_b);
+
+        for (size_t byte = 0; byte < COLUMN_BYTES; ++byte)
+        {
+            bytes[byte] = _mm256_add_epi64(bytes[byte], _mm256_and_si256(_mm256_srli_epi64(sixteens, byte), mask));
+        }
+
+        blocks += 1;
+
+        if (blocks == COLUMN_BYTE_LIMIT)
+        {
+            flush_bytes_avx2(bytes, column_offset, column_counts, total_columns);
+            blocks = 0;
+        }
+    }
+
+    flush_bytes_avx2(bytes, column_offset, column_counts, total_columns);
+
+    uint64_t lanes[4];
+
+    _mm256_storeu_si256((__m256i*) lanes, eights);
+    add_lane_bits(lanes, 4, 8, column_offset, column_counts, total_columns);
+
+    _mm256_storeu_si256((__m256i*) lanes, fours);
+    add_lane_bits(lanes, 4, 4, column_offset, column_counts, total_columns);
+
+    _mm256_storeu_si256((__m256i*) lanes, twos);
+    add_lane_bits(lanes, 4, 2, column_offset, column_counts, total_columns);
+
+    _mm256_storeu_si256((__m256i*) lanes, ones);
+    add_lane_bits(lanes, 4, 1, column_offset, column_counts, total_columns);
+
+    count_ones_sliced(array + row_index, length - row_index, column_offset, column_counts, total_columns);
+}
+
+__attribute__((target("avx512f")))
+static inline void carry_save_add_avx512(__m512i* high, __m512i* low, __m512i a, __m512i b)
+{
+    *high = _mm512_ternarylogic_epi64(*low, a, b, 0xe8);
+    *low = _mm512_ternarylogic_epi64(*low, a, b, 0x96);
+}
+
+__attribute__((target("avx512f")))
+static void flush_bytes_avx512(__m512i* bytes, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    uint64_t lanes[COLUMN_BYTES * 8];
+
+    for (size_t byte = 0; byte < COLUMN_BYTES; ++byte)
+    {
+        _mm512_storeu_si512(&lanes[byte * 8], bytes[byte]);
+        bytes[byte] = _mm512_setzero_si512();
+    }
+
+    flush_lane_bytes(lanes, 8, column_offset, column_counts, total_columns);
+}
+
+__attribute__((target("avx512f")))
+static void count_ones_avx512(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    __m512i mask = _mm512_set1_epi64(COLUMN_BYTE_MASK);
+
+    __m512i ones = _mm512_setzero_si512();
+    __m512i twos = _mm512_setzero_si512();
+    __m512i fours = _mm512_setzero_si512();
+    __m512i eights = _mm512_setzero_si512();
+
+    __m512i bytes[COLUMN_BYTES];
+
+    for (size_t byte = 0; byte < COLUMN_BYTES; ++byte)
+    {
+        bytes[byte] = _mm512_setzero_si512();
+    }
+
+    size_t blocks = 0;
+    size_t row_index = 0;
+
+    for (; row_index + COLUMN_BLOCK * 8 <= length; row_index += COLUMN_BLOCK * 8)
+    {
+        const uint64_t* row = &array[row_index];
+
+        __m512i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+
+        carry_save_add_avx512(&twos_a, &ones, _mm512_loadu_si512(&row[0]), _mm512_loadu_si512(&row[8]));
+        carry_save_add_avx512(&twos_b, &ones, _mm512_loadu_si512(&row[16]), _mm512_loadu_si512(&row[24]));
+        carry_save_add_avx512(&fours_a, &twos, twos_a, twos_b);
+        carry_save_add_avx512(&twos_a, &ones, _mm512_loadu_si512(&row[32]), _mm512_loadu_si512(&row[40]));
+        carry_save_add_avx512(&twos_b, &ones, _mm512_loadu_si512(&row[48]), _mm512_loadu_si512(&row[56]));
+        carry_save_add_avx512(&fours_b, &twos, twos_a, twos_b);
+        carry_save_add_avx512(&eights_a, &fours, fours_a, fours_b);
+
+        carry_save_add_avx512(&twos_a, &ones, _mm512_loadu_si512(&row[64]), _mm512_loadu_si512(&row[72]));
+        carry_save_add_avx512(&twos_b, &ones, _mm512_loadu_si512(&row[80]), _mm512_loadu_si512(&row[88]));
+        carry_save_add_avx512(&fours_a, &twos, twos_a, twos_b);
+        carry_save_add_avx512(&twos_a, &ones, _mm512_loadu_si512(&row[96]), _mm512_loadu_si512(&row[104]));
+        carry_save_add_avx512(&twos_b, &ones, _mm512_loadu_si512(&row[112]), _mm512_loadu_si512(&row[120]));
+        carry_save_add_avx512(&fours_b, &twos, twos_a, twos_b);
+        carry_save_add_avx512(&eights_b, &fours, fours_a, fours_b);
+
+        carry_save_add_avx512(&sixteens, &eights, eights_a, eights_b);
+
+        for (size_t byte = 0; byte < COLUMN_BYTES; ++byte)
+        {
+            bytes[byte] = _mm512_add_epi64(bytes[byte], _mm512_and_si512(_mm512_srli_epi64(sixteens, byte), mask));
+        }
+
+        blocks += 1;
+
+        if (blocks == COLUMN_BYTE_LIMIT)
+        {
+            flush_bytes_avx512(bytes, column_offset, column_counts, total_columns);
+            blocks = 0;
+        }
+    }
+
+    flush_bytes_avx512(bytes, column_offset, column_counts, total_columns);
+
+    uint64_t lanes[8];
+
+    _mm512_storeu_si512(lanes, eights);
+    add_lane_bits(lanes, 8, 8, column_offset, column_counts, total_columns);
+
+    _mm512_storeu_si512(lanes, fours);
+    add_lane_bits(lanes, 8, 4, column_offset, column_counts, total_columns);
+
+    _mm512_storeu_si512(lanes, twos);
+    add_lane_bits(lanes, 8, 2, column_offset, column_counts, total_columns);
+
+    _mm512_storeu_si512(lanes, ones);
+    add_lane_bits(lanes, 8, 1, column_offset, column_counts, total_columns);
+
+    count_ones_sliced(array + row_index, length - row_index, column_offset, column_counts, total_columns);
+}
+
+#endif
+
+static const struct column_functions column_levels[] =
+{
+    [column_level_scalar] = {count_ones_sliced},
+#if COLUMN_X86
+    [column_level_avx2] = {count_ones_avx2},
+    [column_level_avx512] = {count_ones_avx512},
+#endif
+};
+
+static const struct column_functions* column_selected = NULL;
+static pthread_once_t column_once = PTHREAD_ONCE_INIT;
+
+static enum column_level column_supported(void)
+{
+#if COLUMN_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) return column_level_avx512;
+    if (__builtin_cpu_supports("avx2")) return column_level_avx2;
+#endif
+
+    return column_level_scalar;
+}
+
+enum column_level column_select(enum column_level level)
+{
+    enum column_level supported = column_supported();
+    if (level > supported) level = supported;
+
+    column_selected = &column_levels[level];
+
+    return level;
+}
+
+static void column_default(void)
+{
+    if (column_selected == NULL) column_select(column_level_avx512);
+}
+
+static const struct column_functions* column_functions(void)
+{
+    pthread_once(&column_once, column_default);
+    return column_selected;
+}
+
+void count_ones_in_columns(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns)
+{
+    if (total_columns <= COLUMN_NARROW) count_ones_narrow(array, length, column_offset, column_counts, total_columns);
+    else if (length < COLUMN_SHORT) count_ones_sliced(array, length, column_offset, column_counts, total_columns);
+    else column_functions()->sliced(array, length, column_offset, column_counts, total_columns);
+}
+
+static void* column_range_main(void* argument)
+{
+    struct column_range* range = argument;
+    count_ones_in_columns(range->array, range->length, range->column_offset, range->column_counts, range->total_columns);
+
+    return NULL;
+}
+
+int count_ones_in_columns_parallel(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns, size_t total_threads)
+{
+    if (total_threads > length / COLUMN_BLOCK) total_threads = length / COLUMN_BLOCK;
+
+    if (total_threads <= 1)
+    {
+        count_ones_in_columns(array, length, column_offset, column_counts, total_columns);
+        return 0;
+    }
+
+    struct column_range* ranges = calloc(total_threads, sizeof(struct column_range));
+    if (ranges == NULL) return -1;
+
+    for (size_t index = 0; index < total_threads; ++index)
+    {
+        size_t begin = length * index / total_threads;
+        size_t end = length * (index + 1) / total_threads;
+
+        ranges[index].array = array + begin;
+        ranges[index].length = end - begin;
+        ranges[index].column_offset = column_offset;
+        ranges[index].total_columns = total_columns;
+    }
+
+    for (size_t index = 1; index < total_threads; ++index)
+    {
+        struct column_range* range = &ranges[index];
+
+        if (pthread_create(&range->thread, NULL, column_range_main, range) == 0) range->started = 1;
+        else column_range_main(range);
+    }
+
+    column_range_main(&ranges[0]);
+
+    for (size_t index = 0; index < total_threads; ++index)
+    {
+        if (ranges[index].started) pthread_join(ranges[index].thread, NULL);
+
+        for (size_t column_index = 0; column_index < total_columns; ++column_index)
+        {
+            column_counts[column_index] += ranges[index].column_counts[column_index];
+        }
+    }
+
+    free(ranges);
+
+    return 0;
+}
+
+static uint64_t common_bit(uint64_t ones, uint64_t zeros, enum mode mode)
+{
+    uint64_t bit = 0;
+    
+    switch (mode)
+    {
+        case mode_most_common: bit = ones >= zeros; break;
+        case mode_least_common: bit = ones < zeros; break;
+    }
+
+    return bit;
+}
+
+static uint64_t common_bits(size_t length, const uint64_t* column_counts, size_t total_columns, enum mode mode)
+{
+    uint64_t result = 0;
+
+    for (size_t column_index = 0; column_index < total_columns; ++column_index)
+    {
+        uint64_t ones = column_counts[column_index];
+        uint64_t zeros = length - ones;
+        
+        result |= common_bit(ones, zeros, mode) << column_index;
+    }
+    
+    return result;
+}
+
+uint64_t most_or_least_common_bit_in_columns(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns, enum mode mode)
+{
+    memset(column_counts, 0, total_columns * sizeof(uint64_t));
+    count_ones_in_columns(array, length, column_offset, column_counts, total_columns);
+
+    return common_bits(length, column_counts, total_columns, mode);
+}
+
+size_t calculate_rating(uint64_t* array, size_t length, size_t total_columns, enum mode mode)
+{
+    size_t column_index = total_columns;
+
+    while (!__builtin_sub_overflow(column_index, 1, &column_index))
+    {
+        size_t row_index = 0;
+        
+        uint64_t column_count = 0;
+        uint64_t rate = most_or_least_common_bit_in_columns(array, length, column_index, &column_count, 1, mode);
+        
+        uint64_t bit = 0;
+        if (rate) bit = 1;
+        
+        while (row_index < length)
+        {
+            if (length == 1) return length;
+            
+            uint64_t row = array[row_index];
+            uint64_t column_bit = (row >> column_index) & 1;
+
+            if (column_bit != bit)
+            {
+                length -= 1;
+                
+                array[row_index] = array[length];
+                array[length] = row;
+
+                continue;
+            }
+
+            row_index += 1;
+        }
+    }
+    
+    return length;
+}
+
+static uint64_t column_mask(size_t total_columns)
+{
+    return total_columns < 64 ? ((uint64_t) 1 << total_columns) - 1 : UINT64_MAX;
+}
+
+static void scatter_rows(const uint64_t* from, uint64_t* to, size_t length, uint64_t mask, size_t shift, size_t* offsets)
+{
+    for (size_t index = 0; index < length; ++index)
+    {
+        to[offsets[((from[index] & mask) >> shift) & 0xff]++] = from[index];
+    }
+}
+
+static int index_rows(struct rating_index* rating_index, const uint64_t* array, size_t length)
+{
+    size_t total_columns = rating_index->total_columns;
+    uint64_t mask = column_mask(total_columns);
+
+    size_t shift = total_columns - rating_index->prefix_bits;
+    size_t total_prefixes = (size_t) 1 << rating_index->prefix_bits;
+
+    size_t total_digits = (total_columns + 7) / 8;
+    size_t digits[8][256] = {{0}};
+
+    size_t* offsets = rating_index->offsets.data;
+    memset(offsets, 0, (total_prefixes + 1) * sizeof(size_t));
+
+    uint64_t outside = 0;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        uint64_t key = array[index] & mask;
+        outside |= array[index] & ~mask;
+
+        for (size_t digit = 0; digit < total_digits; ++digit)
+        {
+            digits[digit][(key >> (digit * 8)) & 0xff] += 1;
+        }
+
+        offsets[(key >> shift) + 1] += 1;
+    }
+
+    for (size_t prefix = 0; prefix < total_prefixes; ++prefix)
+    {
+        offsets[prefix + 1] += offsets[prefix];
+    }
+
+    rating_index->offsets.length = total_prefixes + 1;
+
+    if (shift == 0 && outside == 0) return 0;
+
+    if (buffer_reserve(&rating_index->rows, length) == -1) return -1;
+
+    uint64_t* rows = rating_index->rows.data;
+    rating_index->rows.length = length;
+
+    size_t passes[8];
+    size_t total_passes = 0;
+
+    for (size_t digit = 0; digit < total_digits; ++digit)
+    {
+        size_t* counts = digits[digit];
+        size_t start = 0;
+        int trivial = 0;
+
+        for (size_t value = 0; value < 256; ++value)
+        {
+            size_t count = counts[value];
+
+            if (count == length) trivial = 1;
+
+            counts[value] = start;
+            start += count;
+        }
+
+        if (!trivial) passes[total_passes++] = digit;
+    }
+
+    if (total_passes == 0)
+    {
+        memcpy(rows, array, length * sizeof(uint64_t));
+        return 0;
+    }
+
+    uint64_t* scratch = NULL;
+
+    if (total_passes > 1)
+    {
+        scratch = malloc(length * sizeof(uint64_t));
+        if (scratch == NULL) return -1;
+    }
+
+    const uint64_t* from = array;
+
+    for (size_t pass = 0; pass < total_passes; ++pass)
+    {
+        uint64_t* to = (total_passes - pass) % 2 == 1 ? rows : scratch;
+        size_t digit = passes[pass];
+
+        scatter_rows(from, to, length, mask, digit * 8, digits[digit]);
+        from = to;
+    }
+
+    if (scratch != NULL) free(scratch);
+
+    return 0;
+}
+
+int rating_index_build(struct rating_index* rating_index, const uint64_t* array, size_t length, size_t total_columns)
+{
+    if (total_columns > 64) total_columns = 64;
+
+    buffer_init(&rating_index->rows, sizeof(uint64_t));
+    buffer_init(&rating_index->offsets, sizeof(size_t));
+
+    rating_index->total_rows = length;
+    rating_index->total_columns = total_columns;
+    rating_index->prefix_bits = total_columns < RATING_PREFIX_BITS ? total_columns : RATING_PREFIX_BITS;
+
+    if (buffer_reserve(&rating_index->offsets, ((size_t) 1 << rating_index->prefix_bits) + 1) == -1) return -1;
+
+    return index_rows(rating_index, array, length);
+}
+
+void rating_index_free(struct rating_index* rating_index)
+{
+    buffer_free(&rating_index->rows);
+    buffer_free(&rating_index->offsets);
+}
+
+static size_t split_rows(const struct rating_index* rating_index, size_t begin, size_t end, uint64_t key, size_t column_index)
+{
+    size_t shift = rating_index->total_columns - rating_index->prefix_bits;
+
+    if (column_index >= shift)
+    {
+        const size_t* offsets = rating_index->offsets.data;
+        return offsets[(key | (uint64_t) 1 << column_index) >> shift];
+    }
+
+    const uint64_t* rows = rating_index->rows.data;
+
+    while (begin < end)
+    {
+        size_t middle = begin + (end - begin) / 2;
+
+        if ((rows[middle] >> column_index) & 1) end = middle;
+        else begin = middle + 1;
+    }
+
+    return begin;
+}
+
+size_t rating_index_find(const struct rating_index* rating_index, enum mode mode, uint64_t* rating)
+{
+    const uint64_t* rows = rating_index->rows.data;
+    size_t remaining = rating_index->rows.length != 0 ? 1 : 0;
+
+    size_t begin = 0;
+    size_t end = rating_index->total_rows;
+
+    uint64_t key = 0;
+    size_t column_index = rating_index->total_columns;
+
+    while (end - begin > remaining && !__builtin_sub_overflow(column_index, 1, &column_index))
+    {
+        size_t split = split_rows(rating_index, begin, end, key, column_index);
+
+        uint64_t ones = end - split;
+        uint64_t zeros = split - begin;
+
+        uint64_t bit = common_bit(ones, zeros, mode);
+
+        if (bit ? ones == 0 : zeros == 0) bit ^= 1;
+
+        if (bit)
+        {
+            begin = split;
+            key |= (uint64_t) 1 << column_index;
+        }
+        else
+        {
+            end = split;
+        }
+    }
+
+    if (begin != end) *rating = remaining != 0 ? rows[begin] : key;
+
+    return end - begin;
+}
+
+static void transpose_block(uint64_t* block)
+{
+    uint64_t mask = UINT64_C(0x00000000ffffffff);
+
+    for (size_t width = 32; width != 0; width >>= 1, mask ^= mask << width)
+    {
+        for (size_t index = 0; index < MATRIX_BLOCK; index = (index + width + 1) & ~width)
+        {
+            uint64_t swap = ((block[index] >> width) ^ block[index + width]) & mask;
+
+            block[index] ^= swap << width;
+            block[index + width] ^= swap;
+        }
+    }
+}
+
+static void* transpose_range_main(void* argument)
+{
+    struct matrix_range* range = argument;
+    struct bit_matrix* matrix = range->matrix;
+
+    uint64_t* words = matrix->words.data;
+
+    size_t total_rows = matrix->total_rows;
+    size_t total_columns = matrix->total_columns;
+    size_t column_stride = matrix->column_stride;
+
+    size_t row_words = range->row_words;
+    size_t stored_words = (total_columns + 63) / 64 < row_words ? (total_columns + 63) / 64 : row_words;
+
+    uint64_t block[MATRIX_BLOCK];
+
+    for (size_t first_word = 0; first_word < stored_words; first_word += MATRIX_LINE)
+    {
+        size_t last_word = stored_words - first_word < MATRIX_LINE ? stored_words : first_word + MATRIX_LINE;
+
+        for (size_t block_index = range->begin; block_index < range->end; ++block_index)
+        {
+            size_t first_row = block_index * MATRIX_BLOCK;
+            size_t total_block_rows = total_rows - first_row < MATRIX_BLOCK ? total_rows - first_row : MATRIX_BLOCK;
+
+            const uint64_t* rows = range->rows + first_row * row_words;
+
+            for (size_t word = first_word; word < last_word; ++word)
+            {
+                size_t row_index = 0;
+
+                for (; row_index < total_block_rows; ++row_index) block[row_index] = rows[row_index * row_words + word];
+                for (; row_index < MATRIX_BLOCK; ++row_index) block[row_index] = 0;
+
+                transpose_block(block);
+
+                size_t first_column = word * 64;
+                size_t total_block_columns = total_columns - first_column < 64 ? total_columns - first_column : 64;
+
+                for (size_t column_index = 0; column_index < total_block_columns; ++column_index)
+                {
+                    words[(first_column + column_index) * column_stride + block_index] = block[column_index];
+                }
+            }
+        }
+    }
+
+    for (size_t column_index = stored_words * 64; column_index < total_columns; ++column_index)
+    {
+        memset(&words[column_index * column_stride + range->begin], 0, (range->end - range->begin) * sizeof(uint64_t));
+    }
+
+    return NULL;
+}
+
+static uint64_t count_words(const uint64_t* words, size_t total_words)
+{
+    uint64_t total = 0;
+
+    uint64_t ones = 0;
+    uint64_t twos = 0;
+    uint64_t fours = 0;
+    uint64_t eights = 0;
+
+    size_t index = 0;
+
+    for (; index + COLUMN_BLOCK <= total_words; index += COLUMN_BLOCK)
+    {
+        total += __builtin_popcountll(add_block(&words[index], &ones, &twos, &fours, &eights));
+    }
+
+    total = total * 16 + __builtin_popcountll(eights) * 8 + __builtin_popcountll(fours) * 4 + __builtin_popcountll(twos) * 2 + __builtin_popcountll(ones);
+
+    for (; index < total_words; ++index)
+    {
+        total += __builtin_popcountll(words[index]);
+    }
+
+    return total;
+}
+
+static void* count_range_main(void* argument)
+{
+    struct matrix_range* range = argument;
+
+    const uint64_t* words = range->matrix->words.data;
+
+    size_t column_words = range->matrix->column_words;
+    size_t column_stride = range->matrix->column_stride;
+
+    for (size_t column_index = range->begin; column_index < range->end; ++column_index)
+    {
+        range->column_counts[column_index] = count_words(&words[column_index * column_stride], column_words);
+    }
+
+    return NULL;
+}
+
+static int run_matrix_ranges(struct bit_matrix* matrix, const uint64_t* rows, size_t row_words, uint64_t* column_counts, size_t total_items, size_t total_threads, void* (*range_main)(void*))
+{
+    size_t total_words = matrix->words.length;
+
+    if (total_threads > total_words / MATRIX_THREAD_WORDS) total_threads = total_words / MATRIX_THREAD_WORDS;
+    if (total_threads > total_items) total_threads = total_items;
+    if (total_threads < 1) total_threads = 1;
+
+    struct matrix_range* ranges = calloc(total_threads, sizeof(struct matrix_range));
+    if (ranges == NULL) return -1;
+
+    for (size_t index = 0; index < total_threads; ++index)
+    {
+        ranges[index].matrix = matrix;
+        ranges[index].rows = rows;
+        ranges[index].row_words = row_words;
+        ranges[index].begin = total_items * index / total_threads;
+        ranges[index].end = total_items * (index + 1) / total_threads;
+        ranges[index].column_counts = column_counts;
+    }
+
+    for (size_t index = 1; index < total_threads; ++index)
+    {
+        struct matrix_range* range = &ranges[index];
+
+        if (pthread_create(&range->thread, NULL, range_main, range) == 0) range->started = 1;
+        else range_main(range);
+    }
+
+    range_main(&ranges[0]);
+
+    for (size_t index = 0; index < total_threads; ++index)
+    {
+        if (ranges[index].started) pthread_join(ranges[index].thread, NULL);
+    }
+
+    free(ranges);
+
+    return 0;
+}
+
+int bit_matrix_build(struct bit_matrix* matrix, const uint64_t* rows, size_t total_rows, size_t row_words, size_t total_columns, size_t total_threads)
+{
+    buffer_init(&matrix->words, sizeof(uint64_t));
+
+    matrix->total_rows = total_rows;
+    matrix->total_columns = total_columns;
+    matrix->column_words = (total_rows + MATRIX_BLOCK - 1) / MATRIX_BLOCK;
+    matrix->column_stride = matrix->column_words;
+
+    if (matrix->column_stride >= MATRIX_LINE)
+    {
+        matrix->column_stride = (matrix->column_stride + MATRIX_LINE - 1) / MATRIX_LINE * MATRIX_LINE;
+        if (matrix->column_stride % MATRIX_PAGE == 0) matrix->column_stride += MATRIX_LINE;
+    }
+
+    size_t total_words;
+
+    if (__builtin_mul_overflow(total_columns, matrix->column_stride, &total_words))
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    if (buffer_reserve(&matrix->words, total_words) == -1) return -1;
+    matrix->words.length = total_words;
+
+    return run_matrix_ranges(matrix, rows, row_words, NULL, matrix->column_words, total_threads, transpose_range_main);
+}
+
+void bit_matrix_free(struct bit_matrix* matrix)
+{
+    buffer_free(&matrix->words);
+}
+
+int bit_matrix_count(struct bit_matrix* matrix, uint64_t* column_counts, size_t total_threads)
+{
+    return run_matrix_ranges(matrix, NULL, 0, column_counts, matrix->total_columns, total_threads, count_range_main);
+}
+
+static uint64_t count_selected(const uint64_t* selection, const uint64_t* column, size_t column_words)
+{
+    uint64_t count = 0;
+
+    for (size_t word = 0; word < column_words; ++word)
+    {
+        count += __builtin_popcountll(selection[word] & column[word]);
+    }
+
+    return count;
+}
+
+static size_t gather_rows(const uint64_t* selection, size_t column_words, size_t* list)
+{
+    size_t count = 0;
+
+    for (size_t word = 0; word < column_words; ++word)
+    {
+        for (uint64_t bits = selection[word]; bits != 0; bits &= bits - 1)
+        {
+            list[count++] = word * 64 + __builtin_ctzll(bits);
+        }
+    }
+
+    return count;
+}
+
+int bit_matrix_find(const struct bit_matrix* matrix, enum mode mode, size_t* row)
+{
+    size_t total_rows = matrix->total_rows;
+    size_t column_words = matrix->column_words;
+
+    if (total_rows == 0) return 0;
+
+    int result = -1;
+
+    const uint64_t* words = matrix->words.data;
+
+    uint64_t* selection = malloc(column_words * sizeof(uint64_t));
+    size_t* list = NULL;
+
+    if (selection == NULL) goto cleanup;
+
+    memset(selection, 0xff, column_words * sizeof(uint64_t));
+    if (total_rows % 64 != 0) selection[column_words - 1] = ((uint64_t) 1 << (total_rows % 64)) - 1;
+
+    size_t count = total_rows;
+    size_t column_index = matrix->total_columns;
+
+    while (count > 1 && count * MATRIX_SPARSE > column_words && column_index != 0)
+    {
+        column_index -= 1;
+
+        const uint64_t* column = &words[column_index * matrix->column_stride];
+
+        uint64_t ones = count_selected(selection, column, column_words);
+        uint64_t zeros = count - ones;
+
+        uint64_t bit = common_bit(ones, zeros, mode);
+        if (bit ? ones == 0 : zeros == 0) continue;
+
+        uint64_t flip = bit ? 0 : UINT64_MAX;
+
+        for (size_t word = 0; word < column_words; ++word)
+        {
+            selection[word] &= column[word] ^ flip;
+        }
+
+        count = bit ? ones : zeros;
+    }
+
+    list = malloc(count * sizeof(size_t));
+    if (list == NULL) goto cleanup;
+
+    gather_rows(selection, column_words, list);
+
+    while (count > 1 && column_index != 0)
+    {
+        column_index -= 1;
+
+        const uint64_t* column = &words[column_index * matrix->column_stride];
+        uint64_t ones = 0;
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            ones += (column[list[index] / 64] >> (list[index] % 64)) & 1;
+        }
+
+        uint64_t zeros = count - ones;
+
+        uint64_t bit = common_bit(ones, zeros, mode);
+        if (bit ? ones == 0 : zeros == 0) continue;
+
+        size_t kept = 0;
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            if (((column[list[index] / 64] >> (list[index] % 64)) & 1) == bit) list[kept++] = list[index];
+        }
+
+        count = kept;
+    }
+
+    *row = list[0];
+    result = 1;
+
+    cleanup: if (selection != NULL) free(selection);
+    if (list != NULL) free(list);
+
+    return result;
+}
+
+static void common_words(size_t length, const uint64_t* column_counts, size_t total_columns, enum mode mode, uint64_t* words)
+{
+    memset(words, 0, (total_columns + 63) / 64 * sizeof(uint64_t));
+
+    for (size_t column_index = 0; column_index < total_columns; ++column_index)
+    {
+        uint64_t ones = column_counts[column_index];
+        uint64_t zeros = length - ones;
+
+        words[column_index / 64] |= common_bit(ones, zeros, mode) << (column_index % 64);
+    }
+}
+
+static void copy_row(const uint64_t* row, size_t row_words, size_t total_words, uint64_t* words)
+{
+    for (size_t word = 0; word < total_words; ++word)
+    {
+        words[word] = word < row_words ? row[word] : 0;
+    }
+}
+
+static int set_product(char* str, const uint64_t* a, const uint64_t* b, size_t total_words)
+{
+    uint64_t* product = calloc(total_words * 2 + 1, sizeof(uint64_t));
+    if (product == NULL) return -1;
+
+    for (size_t index = 0; index < total_words; ++index)
+    {
+        uint64_t carry = 0;
+
+        for (size_t other = 0; other < total_words; ++other)
+        {
+            unsigned __int128 current = (unsigned __int128) a[index] * b[other] + product[index + other] + carry;
+
+            product[index + other] = current;
+            carry = current >> 64;
+        }
+
+        product[index + total_words] = carry;
+    }
+
+    int result = solver_format_words(str, SOLVER_ANSWER_SIZE, product, total_words * 2);
+    free(product);
+
+    return result;
+}
+
+static int finish_wide(struct challenge_3_workspace* workspace, size_t total_columns, struct solver_answers* answers)
+{
+    int result = -1;
+
+    const uint64_t* array = workspace->rows.data;
+    size_t words = row_words(workspace->total_columns);
+    size_t length = workspace->rows.length / words;
+
+    size_t rate_words = (total_columns + 63) / 64;
+    size_t rating_words = rate_words > words ? rate_words : words;
+
+    struct bit_matrix matrix;
+
+    uint64_t* column_counts = calloc(total_columns, sizeof(uint64_t));
+    uint64_t* rates = calloc(rate_words * 2 + rating_words * 2, sizeof(uint64_t));
+
+    if (bit_matrix_build(&matrix, array, length, words, total_columns, workspace->total_threads) == -1) goto cleanup;
+    if (column_counts == NULL || rates == NULL) goto cleanup;
+
+    if (bit_matrix_count(&matrix, column_counts, workspace->total_threads) == -1) goto cleanup;
+
+    uint64_t* gamma_rate = rates;
+    uint64_t* epsilon_rate = rates + rate_words;
+    uint64_t* oxygen = rates + rate_words * 2;
+    uint64_t* carbon = oxygen + rating_words;
+
+    common_words(length, column_counts, total_columns, mode_most_common, gamma_rate);
+    common_words(length, column_counts, total_columns, mode_least_common, epsilon_rate);
+
+    size_t row;
+    int found;
+
+    if ((found = bit_matrix_find(&matrix, mode_most_common, &row)) == -1) goto cleanup;
+    if (found) copy_row(array + row * words, words, rating_words, oxygen);
+
+    if ((found = bit_matrix_find(&matrix, mode_least_common, &row)) == -1) goto cleanup;
+    if (found) copy_row(array + row * words, words, rating_words, carbon);
+
+    if (set_product(answers->part_1, gamma_rate, epsilon_rate, rate_words) == -1) goto cleanup;
+    if (set_product(answers->part_2, oxygen, carbon, rating_words) == -1) goto cleanup;
+
+    result = 0;
+
+    cleanup: bit_matrix_free(&matrix);
+
+    if (column_counts != NULL) free(column_counts);
+    if (rates != NULL) free(rates);
+
+    return result;
+}
+
+void challenge_3_init(struct challenge_3_workspace* workspace)
+{
+    buffer_init(&workspace->rows, sizeof(uint64_t));
+
+    workspace->total_columns = 0;
+    workspace->total_threads = 1;
+    workspace->stats = NULL;
+}
+
+void challenge_3_free(struct challenge_3_workspace* workspace)
+{
+    buffer_free(&workspace->rows);
+}
+
+int challenge_3_parse(const struct input* input, const size_t* hints, struct challenge_3_workspace* workspace)
+{
+    struct buffer* rows = &workspace->rows;
+    buffer_clear(rows);
+
+    if (buffer_reserve(rows, hints[0]) == -1) return -1;
+    return read_input(input, rows, &workspace->total_columns);
+}
+
+int challenge_3_finish(struct challenge_3_workspace* workspace, const size_t* hints, struct solver_answers* answers)
+{
+    const uint64_t* array = workspace->rows.data;
+    size_t length = workspace->rows.length;
+
+    size_t total_columns = workspace->total_columns;
+
+    if (hints[1] != 0) total_columns = hints[1];
+    if (total_columns > 64 || workspace->total_columns > 64) return finish_wide(workspace, total_columns, answers);
+
+    uint64_t column_counts[64] = {0};
+
+    if (count_ones_in_columns_parallel(array, length, 0, column_counts, total_columns, workspace->total_threads) == -1) return -1;
+    
+    uint64_t gamma_rate = common_bits(length, column_counts, total_columns, mode_most_common);
+    uint64_t eplison_rate = common_bits(length, column_counts, total_columns, mode_least_common);
+    
+    uint64_t oxygen = 0;
+    uint64_t carbon = 0;
+
+    struct rating_index rating_index;
+
+    if (rating_index_build(&rating_index, array, length, total_columns) == -1)
+    {
+        rating_index_free(&rating_index);
+        return -1;
+    }
+
+    rating_index_find(&rating_index, mode_most_common, &oxygen);
+    rating_index_find(&rating_index, mode_least_common, &carbon);
+
+    rating_index_free(&rating_index);
+
+    if (set_product(answers->part_1, &gamma_rate, &eplison_rate, 1) == -1) return -1;
+    if (set_product(answers->part_2, &oxygen, &carbon, 1) == -1) return -1;
+
+    return 0;
+}
+
+int challenge_3_load(const struct cache* cache, struct challenge_3_workspace* workspace)
+{
+    size_t words = row_words(cache->params[0]);
+
+    if (cache->section_sizes[0] % (words * sizeof(uint64_t)) != 0)
+    {
+        errno = ESTALE;
+        return -1;
+    }
+
+    size_t length_0 = cache->section_sizes[0] / sizeof(uint64_t);
+
+    buffer_clear(&workspace->rows);
+    if (buffer_reserve(&workspace->rows, length_0) == -1) return -1;
+
+    memcpy(workspace->rows.data, cache->sections[0], cache->section_sizes[0]);
+    workspace->rows.length = length_0;
+    workspace->total_columns = cache->params[0];
+
+    return 0;
+}
+
+int challenge_3_store(const char* name, const struct challenge_3_workspace* workspace)
+{
+    uint64_t params[CACHE_PARAMS] = {workspace->total_columns};
+
+    const void* sections[CACHE_SECTIONS] = {workspace->rows.data, NULL};
+    size_t section_sizes[CACHE_SECTIONS] = {workspace->rows.length * sizeof(uint64_t), 0};
+
+    return cache_write(name, 3, params, sections, section_sizes);
+}
+
+int challenge_3_solve(const struct input* input, const size_t* hints, struct challenge_3_workspace* workspace, struct solver_answers* answers)
+{
+    stats_begin(workspace->stats);
+    if (challenge_3_parse(input, hints, workspace) == -1) return -1;
+
+    stats_end(workspace->stats, stats_parse);
+
+    int result = challenge_3_finish(workspace, hints, answers);
+    stats_end(workspace->stats, stats_solve);
+
+    return result;
+}
+
+static void init_workspace(void* workspace)
+{
+    challenge_3_init(workspace);
+}
+
+static void free_workspace(void* workspace)
+{
+    challenge_3_free(workspace);
+}
+
+static int solve_input(const struct input* input, const size_t* hints, void* workspace, struct solver_answers* answers)
+{
+    return challenge_3_solve(input, hints, workspace, answers);
+}
+
+const struct solver challenge_3_solver = {"3", sizeof(struct challenge_3_workspace), init_workspace, free_workspace, solve_input};
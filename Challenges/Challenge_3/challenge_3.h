@@ -0,0 +1,82 @@
+#ifndef CHALLENGE_3_H
+#define CHALLENGE_3_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+enum mode
+{
+    mode_none = 0,
+    mode_most_common = 1,
+    mode_least_common = 2,
+};
+
+enum column_level
+{
+    column_level_scalar = 0,
+    column_level_avx2 = 1,
+    column_level_avx512 = 2,
+};
+
+#define RATING_PREFIX_BITS 16
+
+struct rating_index
+{
+    struct buffer rows;
+    struct buffer offsets;
+
+    size_t total_rows;
+    size_t total_columns;
+    size_t prefix_bits;
+};
+
+struct bit_matrix
+{
+    struct buffer words;
+
+    size_t total_rows;
+    size_t total_columns;
+    size_t column_words;
+    size_t column_stride;
+};
+
+struct challenge_3_workspace
+{
+    struct buffer rows;
+    size_t total_columns;
+    size_t total_threads;
+
+    struct stats* stats;
+};
+
+extern const struct solver challenge_3_solver;
+
+int challenge_3_read(const char* str, const char* last, struct buffer* array, size_t* total_columns);
+enum column_level column_select(enum column_level level);
+void count_ones_in_columns(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns);
+int count_ones_in_columns_parallel(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns, size_t total_threads);
+uint64_t most_or_least_common_bit_in_columns(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns, enum mode mode);
+size_t calculate_rating(uint64_t* array, size_t length, size_t total_columns, enum mode mode);
+int rating_index_build(struct rating_index* rating_index, const uint64_t* array, size_t length, size_t total_columns);
+void rating_index_free(struct rating_index* rating_index);
+size_t rating_index_find(const struct rating_index* rating_index, enum mode mode, uint64_t* rating);
+int bit_matrix_build(struct bit_matrix* matrix, const uint64_t* rows, size_t total_rows, size_t row_words, size_t total_columns, size_t total_threads);
+void bit_matrix_free(struct bit_matrix* matrix);
+int bit_matrix_count(struct bit_matrix* matrix, uint64_t* column_counts, size_t total_threads);
+int bit_matrix_find(const struct bit_matrix* matrix, enum mode mode, size_t* row);
+
+void challenge_3_init(struct challenge_3_workspace* workspace);
+void challenge_3_free(struct challenge_3_workspace* workspace);
+int challenge_3_parse(const struct input* input, const size_t* hints, struct challenge_3_workspace* workspace);
+int challenge_3_finish(struct challenge_3_workspace* workspace, const size_t* hints, struct solver_answers* answers);
+int challenge_3_load(const struct cache* cache, struct challenge_3_workspace* workspace);
+int challenge_3_store(const char* name, const struct challenge_3_workspace* workspace);
+int challenge_3_solve(const struct input* input, const size_t* hints, struct challenge_3_workspace* workspace, struct solver_answers* answers);
+
+#endif
@@ -1,211 +1,145 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <inttypes.h>
-#include <ctype.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 
 #include <unistd.h>
-#include <fcntl.h>
-#include <sys/types.h>
-#include <sys/stat.h>
 
-enum mode
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/stream.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+#include "challenge_3.h"
+
+struct stream_context
 {
-    mode_none = 0,
-    mode_most_common = 1,
-    mode_least_common = 2,
+    struct buffer* rows;
+    size_t total_columns;
+
+    struct stats* stats;
 };
 
-void skip_space(char* str, char** end)
+static const char* consume_chunk(const char* str, const char* last, int final, void* context)
 {
-    char* a = *end;
+    struct stream_context* c = context;
+    const char* end = final ? last : stream_split(str, last, '\n');
 
-    while (str != a)
-    {
-        if (!isspace(*str)) break;
-        str += 1;
-    }
+    stats_end(c->stats, stats_read);
+    if (challenge_3_read(str, end, c->rows, &c->total_columns) == -1) return NULL;
+
+    stats_end(c->stats, stats_parse);
 
-    *end = str;
+    return end;
 }
 
-int read_input(const char* name, uint64_t* array, size_t* length)
+static int read_stream(const char* name, struct buffer* rows, size_t* total_columns, struct stats* stats)
 {
-    int file = -1;
-    char* mem = NULL;
-    
-    file = open(name, O_RDONLY);
-    if (file == -1) goto cleanup;
+    int file = stream_open(name);
+    if (file == -1) return -1;
 
-    struct stat64 stat;
-    fstat64(file, &stat);
+    struct stream_context context = {rows, 0, stats};
+    stats_begin(stats);
 
-    mem = malloc(stat.st_size + 1);
-    if (mem == NULL) goto cleanup;
+    int result = stream_run(file, consume_chunk, &context);
+    *total_columns = context.total_columns;
 
-    size_t mem_index = 0;
-    size_t mem_remaining = stat.st_size;
+    stream_close(file);
 
-    while (mem_remaining != 0)
-    {
-        ssize_t chars = read(file, mem + mem_index, mem_remaining);
-        if (chars == -1) goto cleanup;
-
-        mem_index += chars;
-        mem_remaining -= chars;
-    }
-    
-    char* last = mem + mem_index;
-    *last = 0;
+    return result;
+}
 
-    char* str = mem;
+int main(int argc, char** argv)
+{
+    struct stats stats;
+    struct stats* active_stats = NULL;
 
-    size_t index = 0;
-    size_t max_length = *length;
+    int write_cache = solver_flag(&argc, argv, "--cache");
+    size_t total_threads = solver_option(&argc, argv, "--threads", sysconf(_SC_NPROCESSORS_ONLN));
 
-    while (index < max_length)
+    if (solver_flag(&argc, argv, "--stats"))
     {
-        char* end;
-
-        end = last;
-        skip_space(str, &end);
-
-        str = end;
-        
-        end = last;
-        uint64_t value = strtoull(str, &end, 2);
-        
-        if (str != end) array[index++] = value;
-        if (str == last) break;
-        
-        str = end;
+        stats_init(&stats);
+        active_stats = &stats;
     }
-    
-    *length = index;
-    
-    cleanup: if (file != -1) close(file);
-    if (mem != NULL) free(mem);
-    
-    return file;
-}
 
-void count_ones_in_columns(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns)
-{
-    for (size_t row_index = 0; row_index < length; ++row_index)
-    {
-        uint64_t row = array[row_index];   
-        row >>= column_offset; 
-    
-        for (size_t column_index = 0; column_index < total_columns; ++column_index)
-        {
-            column_counts[column_index] += row & 1;
-            row >>= 1;
-        }
-    }
-}
+    if (argc < 2) return EXIT_FAILURE;
 
-uint64_t most_or_least_common_bit_in_columns(const uint64_t* array, size_t length, size_t column_offset, uint64_t* column_counts, size_t total_columns, enum mode mode)
-{
-    uint64_t result = 0;
-    
-    memset(column_counts, 0, total_columns * sizeof(uint64_t));
-    count_ones_in_columns(array, length, column_offset, column_counts, total_columns);
+    size_t hints[SOLVER_MAX_HINTS];
+    solver_parse_hints(argc - 2, argv + 2, hints);
+
+    struct solver_answers answers;
+
+    struct challenge_3_workspace workspace;
+    challenge_3_init(&workspace);
 
-    for (size_t column_index = 0; column_index < total_columns; ++column_index)
+    workspace.total_threads = total_threads;
+
+    int status = EXIT_SUCCESS;
+    int result = 0;
+
+    if (stream_wanted(argv[1]))
     {
-        uint64_t ones = column_counts[column_index];
-        uint64_t zeros = length - ones;
-        
-        uint64_t bit = 0;
-        
-        switch (mode)
-        {
-            case mode_most_common: bit = ones >= zeros; break;
-            case mode_least_common: bit = ones < zeros; break;
-        }
-        
-        result |= bit << column_index;
-    }
-    
-    return result;
-}
+        result = buffer_reserve(&workspace.rows, hints[0]);
 
-size_t calculate_rating(uint64_t* array, size_t length, size_t total_columns, enum mode mode)
-{
-    size_t column_index = total_columns;
+        if (result != -1) result = read_stream(argv[1], &workspace.rows, &workspace.total_columns, active_stats);
+        if (result != -1) result = challenge_3_finish(&workspace, hints, &answers);
 
-    while (!__builtin_sub_overflow(column_index, 1, &column_index))
+        stats_end(active_stats, stats_solve);
+    }
+    else
     {
-        size_t row_index = 0;
-        
-        uint64_t column_count = 0;
-        uint64_t rate = most_or_least_common_bit_in_columns(array, length, column_index, &column_count, 1, mode);
-        
-        uint64_t bit = 0;
-        if (rate) bit = 1;
-        
-        while (row_index < length)
+        struct cache cache;
+        struct input input;
+
+        stats_begin(active_stats);
+
+        if (cache_open(argv[1], 3, &cache) == 0)
         {
-            if (length == 1) return length;
-            
-            uint64_t row = array[row_index];
-            uint64_t column_bit = (row >> column_index) & 1;
+            stats_end(active_stats, stats_read);
 
-            if (column_bit != bit)
+            result = challenge_3_load(&cache, &workspace);
+            cache_close(&cache);
+        }
+        else
+        {
+            if (input_open(argv[1], &input) == -1)
             {
-                length -= 1;
-                
-                array[row_index] = array[length];
-                array[length] = row;
-
-                continue;
+                perror("Failed to read input file");
+                status = EXIT_FAILURE;
+                goto cleanup;
             }
 
-            row_index += 1;
-        }
-    }
-    
-    return length;
-}
+            stats_end(active_stats, stats_read);
 
-int main(int argc, char** argv)
-{
-    if (argc < 4) return EXIT_FAILURE;
+            result = challenge_3_parse(&input, hints, &workspace);
+            input_close(&input);
 
-    uint64_t* array = NULL;
-    uint64_t* column_counts = NULL;
+            if (result != -1 && write_cache && challenge_3_store(argv[1], &workspace) == -1) perror("Failed to write cache");
+        }
 
-    size_t length = strtoull(argv[2], NULL, 10);
-    size_t total_columns = strtoull(argv[3], NULL, 10);
+        stats_end(active_stats, stats_parse);
 
-    array = malloc(length * sizeof(uint64_t));
-    if (array == NULL) goto cleanup;
+        if (result != -1) result = challenge_3_finish(&workspace, hints, &answers);
+        stats_end(active_stats, stats_solve);
+    }
 
-    if (read_input(argv[1], array, &length) == -1)
+    if (result == -1)
     {
-        perror("Failed to read input file");
-        return EXIT_FAILURE;
+        perror("Failed to parse input file");
+        status = EXIT_FAILURE;
+        goto cleanup;
     }
+
+    solver_print(&answers);
+    if (active_stats != NULL) stats_print(active_stats, 3);
     
-    column_counts = malloc(total_columns * sizeof(uint64_t));
-    if (column_counts == NULL) goto cleanup;
-    
-    uint64_t gamma_rate = most_or_least_common_bit_in_columns(array, length, 0, column_counts, total_columns, mode_most_common);
-    uint64_t eplison_rate = most_or_least_common_bit_in_columns(array, length, 0, column_counts, total_columns, mode_least_common);
-    
-    uint64_t oxygen = 0;
-    uint64_t carbon = 0;
-    
-    if (calculate_rating(array, length, total_columns, mode_most_common)) oxygen = array[0];
-    if (calculate_rating(array, length, total_columns, mode_least_common)) carbon = array[0];
-    
-    printf("ANSWER PART I: %" PRIu64 "\n", gamma_rate * eplison_rate);
-    printf("ANSWER PART II: %" PRIu64 "\n", oxygen * carbon);
-    
-    cleanup: if (array != NULL) free(array);
-    if (column_counts != NULL) free(column_counts);
+    cleanup: challenge_3_free(&workspace);
+    if (active_stats != NULL) stats_free(active_stats);
     
-    return EXIT_SUCCESS;
+    return status;
 }
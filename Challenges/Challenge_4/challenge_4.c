@@ -0,0 +1,433 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/scan.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+#include "challenge_4.h"
+
+static void skip_newline(const char* str, const char** end)
+{
+    const char* a = *end;
+
+    const char* b = str + 1;
+    const char* c = str + 2;
+
+    const char* d = str;
+
+    if (str != a && *str == '\n') d = b;    
+    if (str != a && b != a && *str == '\r' && *b == '\n') d = c;
+
+    *end = d;
+}
+
+int challenge_4_read(struct bingo_reader* reader, const char* str, const char* last, struct buffer* array, struct buffer* board_numbers)
+{
+    while (str != last && !reader->boards)
+    {
+        const char* end;
+
+        end = last;
+        scan_non_digit(str, &end);
+        
+        str = end;
+        
+        end = last;
+        uint64_t value = scan_decimal(str, &end);
+        
+        if (str != end)
+        {
+            uint64_t* slot = buffer_push(array);
+            if (slot == NULL) return -1;
+
+            *slot = value;
+        }
+
+        if (str == last) break;
+        
+        str = end;
+
+        end = last;
+        skip_newline(str, &end);
+        
+        const char* temp = str;
+        str = end;
+
+        if (temp != end) reader->boards = 1;
+        if (temp == last) break;
+    }
+
+    while (str != last && !reader->measured)
+    {
+        const char* line_end = memchr(str, '\n', last - str);
+        if (line_end == NULL) line_end = last;
+
+        size_t count = 0;
+
+        while (str != line_end)
+        {
+            const char* end;
+
+            end = line_end;
+            scan_non_digit(str, &end);
+
+            str = end;
+
+            end = line_end;
+            uint64_t value = scan_decimal(str, &end);
+
+            if (str != end)
+            {
+                uint64_t* slot = buffer_push(board_numbers);
+                if (slot == NULL) return -1;
+
+                *slot = value;
+                count += 1;
+            }
+
+            str = end;
+        }
+
+        if (count == 0 && reader->height != 0) reader->measured = 1;
+        if (count != 0 && reader->height == 0) reader->width = count;
+        if (count != 0) reader->height += 1;
+
+        if (str != last) str += 1;
+    }
+    
+    while (str != last)
+    {
+        const char* end;
+
+        end = last;
+        scan_non_digit(str, &end);
+
+        str = end;
+        
+        end = last;
+        uint64_t value = scan_decimal(str, &end);
+        
+        if (str != end)
+        {
+            uint64_t* slot = buffer_push(board_numbers);
+            if (slot == NULL) return -1;
+
+            *slot = value;
+        }
+
+        if (str == last) break;
+        
+        str = end;
+    }
+    
+    return 0;
+}
+
+static int read_input(const struct input* input, struct buffer* array, struct buffer* board_numbers, size_t* width, size_t* height)
+{
+    struct bingo_reader reader;
+    memset(&reader, 0, sizeof(struct bingo_reader));
+
+    if (challenge_4_read(&reader, input->begin, input->end, array, board_numbers) == -1) return -1;
+
+    if (*width == 0) *width = reader.width;
+    if (*height == 0) *height = reader.height;
+
+    return 0;
+}
+
+size_t find_drawn_on_board(const uint64_t* board, size_t width, size_t height, uint64_t drawn)
+{
+    for (size_t index = 0; index < width * height; ++index)
+    {
+        if (board[index] == drawn) return index;
+    }
+
+    return -1;
+}
+
+int check_board_row(const uint64_t* board, size_t row_index, size_t width)
+{
+    size_t count = 0;
+    size_t offset = row_index * width;
+
+    for (size_t index = offset; index < offset + width; ++index)
+    {
+        if (board[index] == MARKED) count += 1; 
+    }
+
+    return count == width;
+}
+
+int check_board_column(const uint64_t* board, size_t column_index, size_t width, size_t height)
+{
+    size_t count = 0;
+    size_t offset = column_index;
+
+    for (size_t index = offset; index < width * height; index += width)
+    {
+        if (board[index] == MARKED) count += 1;
+    }
+
+    return count == height;
+}
+
+void bingo_draw_one(uint64_t drawn, uint64_t* board_numbers, size_t width, size_t height, size_t total_boards, size_t* winners, size_t* total_winners)
+{
+    size_t winner_index = 0;
+    size_t board_size = width * height;
+
+    for (size_t board_index = 0; board_index < total_boards; ++board_index)
+    {
+        uint64_t* board = &board_numbers[board_index * board_size];
+        size_t drawn_index = find_drawn_on_board(board, width, height, drawn);
+
+        if (drawn_index >= board_size) continue;
+        board[drawn_index] = MARKED;
+
+        size_t row_index = drawn_index / width;
+        size_t column_index = drawn_index % width;
+        
+        if (check_board_row(board, row_index, width) || check_board_column(board, column_index, width, height))
+        {
+             winners[winner_index++] = board_index;        
+        }
+    }
+
+    *total_winners = winner_index;
+}
+
+size_t bingo_game(const uint64_t* array, size_t length, uint64_t* board_numbers, size_t width, size_t height, size_t total_boards, size_t* winners, size_t* total_winners)
+{
+    *total_winners = 0;
+
+    if (total_boards == 0) return length;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        uint64_t drawn = array[index];
+        bingo_draw_one(drawn, board_numbers, width, height, total_boards, winners, total_winners);
+   
+        if (*total_winners > 0) return index;
+    }
+    
+    return length;
+}
+
+uint64_t calculate_unmarked_sum(const uint64_t* board, size_t width, size_t height)
+{
+    uint64_t sum = 0;
+    size_t board_size = width * height;
+
+    for (size_t index = 0; index < board_size; ++index)
+    {
+        uint64_t number = board[index];
+        if (number != MARKED) sum += number;
+    }
+    
+    return sum;
+}
+
+int challenge_4_finish(struct challenge_4_workspace* workspace, const size_t* hints, struct solver_answers* answers)
+{
+    size_t width = hints[1] != 0 ? hints[1] : workspace->width;
+    size_t height = hints[2] != 0 ? hints[2] : workspace->height;
+
+    uint64_t* array = workspace->draws.data;
+    size_t length = workspace->draws.length;
+
+    uint64_t* board_numbers = workspace->boards.data;
+
+    size_t board_size;
+
+    if (__builtin_mul_overflow(width, height, &board_size))
+    {
+        errno = ERANGE;
+        return -1;
+    }
+
+    size_t total_boards = board_size != 0 ? workspace->boards.length / board_size : 0;
+    
+    if (buffer_reserve(&workspace->winners, total_boards) == -1) return -1;
+
+    size_t* winners = workspace->winners.data;
+
+    size_t total_winners = 0;
+    size_t last_drawn_index = bingo_game(array, length, board_numbers, width, height, total_boards, winners, &total_winners);
+    
+    uint64_t last_drawn_1 = 0;
+    if (last_drawn_index < length) last_drawn_1 = array[last_drawn_index];
+    
+    uint64_t unmarked_sum_1 = 0;
+    
+    if (total_winners >= 1)
+    {
+        size_t board_numbers_index = winners[0] * board_size;
+        unmarked_sum_1 = calculate_unmarked_sum(&board_numbers[board_numbers_index], width, height);
+    }
+    
+    while (last_drawn_index != length && total_boards > 1)
+    {
+        for (size_t winner_index = 0; winner_index < total_winners; ++winner_index)
+        {
+            total_boards -= 1;
+
+            size_t index_1 = winners[winner_index] * board_size;
+            size_t index_2 = total_boards * board_size;
+
+            for (size_t offset = 0; offset < board_size; ++offset)
+            {
+                uint64_t temp = board_numbers[index_1 + offset];
+                
+                board_numbers[index_1 + offset] = board_numbers[index_2 + offset];
+                board_numbers[index_2 + offset] = temp;
+            }
+        }
+
+        size_t a = last_drawn_index + 1;
+        size_t b = bingo_game(&array[a], length - a, board_numbers, width, height, total_boards, winners, &total_winners);
+        
+        last_drawn_index = a + b;
+    }
+
+    uint64_t last_drawn_2 = 0;
+    if (last_drawn_index < length) last_drawn_2 = array[last_drawn_index];
+
+    uint64_t unmarked_sum_2 = 0;
+    if (total_boards >= 1) unmarked_sum_2 = calculate_unmarked_sum(board_numbers, width, height);
+    
+    solver_set_u64(answers, last_drawn_1 * unmarked_sum_1, last_drawn_2 * unmarked_sum_2);
+
+    return 0;
+}
+
+void challenge_4_init(struct challenge_4_workspace* workspace)
+{
+    buffer_init(&workspace->draws, sizeof(uint64_t));
+    buffer_init(&workspace->boards, sizeof(uint64_t));
+    buffer_init(&workspace->winners, sizeof(size_t));
+
+    workspace->width = 0;
+    workspace->height = 0;
+    workspace->stats = NULL;
+}
+
+void challenge_4_free(struct challenge_4_workspace* workspace)
+{
+    buffer_free(&workspace->draws);
+    buffer_free(&workspace->boards);
+    buffer_free(&workspace->winners);
+}
+
+int challenge_4_reserve(struct challenge_4_workspace* workspace, const size_t* hints)
+{
+    buffer_clear(&workspace->draws);
+    buffer_clear(&workspace->boards);
+
+    workspace->width = 0;
+    workspace->height = 0;
+
+    size_t total_numbers;
+
+    if (__builtin_mul_overflow(hints[1], hints[2], &total_numbers) || __builtin_mul_overflow(total_numbers, hints[3], &total_numbers))
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    if (buffer_reserve(&workspace->draws, hints[0]) == -1) return -1;
+    if (buffer_reserve(&workspace->boards, total_numbers) == -1) return -1;
+
+    return 0;
+}
+
+int challenge_4_parse(const struct input* input, const size_t* hints, struct challenge_4_workspace* workspace)
+{
+    if (challenge_4_reserve(workspace, hints) == -1) return -1;
+    return read_input(input, &workspace->draws, &workspace->boards, &workspace->width, &workspace->height);
+}
+
+int challenge_4_load(const struct cache* cache, struct challenge_4_workspace* workspace)
+{
+    if (cache->section_sizes[0] % sizeof(uint64_t) != 0)
+    {
+        errno = ESTALE;
+        return -1;
+    }
+
+    size_t length_0 = cache->section_sizes[0] / sizeof(uint64_t);
+
+    buffer_clear(&workspace->draws);
+    if (buffer_reserve(&workspace->draws, length_0) == -1) return -1;
+
+    memcpy(workspace->draws.data, cache->sections[0], cache->section_sizes[0]);
+    workspace->draws.length = length_0;
+
+    if (cache->section_sizes[1] % sizeof(uint64_t) != 0)
+    {
+        errno = ESTALE;
+        return -1;
+    }
+
+    size_t length_1 = cache->section_sizes[1] / sizeof(uint64_t);
+
+    buffer_clear(&workspace->boards);
+    if (buffer_reserve(&workspace->boards, length_1) == -1) return -1;
+
+    memcpy(workspace->boards.data, cache->sections[1], cache->section_sizes[1]);
+    workspace->boards.length = length_1;
+
+    workspace->width = cache->params[0];
+    workspace->height = cache->params[1];
+
+    return 0;
+}
+
+int challenge_4_store(const char* name, const struct challenge_4_workspace* workspace)
+{
+    uint64_t params[CACHE_PARAMS] = {workspace->width, workspace->height};
+
+    const void* sections[CACHE_SECTIONS] = {workspace->draws.data, workspace->boards.data};
+    size_t section_sizes[CACHE_SECTIONS] = {workspace->draws.length * sizeof(uint64_t), workspace->boards.length * sizeof(uint64_t)};
+
+    return cache_write(name, 4, params, sections, section_sizes);
+}
+
+int challenge_4_solve(const struct input* input, const size_t* hints, struct challenge_4_workspace* workspace, struct solver_answers* answers)
+{
+    stats_begin(workspace->stats);
+    if (challenge_4_parse(input, hints, workspace) == -1) return -1;
+
+    stats_end(workspace->stats, stats_parse);
+
+    int result = challenge_4_finish(workspace, hints, answers);
+    stats_end(workspace->stats, stats_solve);
+
+    return result;
+}
+
+static void init_workspace(void* workspace)
+{
+    challenge_4_init(workspace);
+}
+
+static void free_workspace(void* workspace)
+{
+    challenge_4_free(workspace);
+}
+
+static int solve_input(const struct input* input, const size_t* hints, void* workspace, struct solver_answers* answers)
+{
+    return challenge_4_solve(input, hints, workspace, answers);
+}
+
+const struct solver challenge_4_solver = {"4", sizeof(struct challenge_4_workspace), init_workspace, free_workspace, solve_input};
@@ -0,0 +1,55 @@
+#ifndef CHALLENGE_4_H
+#define CHALLENGE_4_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+#define MARKED ((uint64_t) -1)
+
+struct bingo_reader
+{
+    int boards;
+    int measured;
+
+    size_t width;
+    size_t height;
+};
+
+struct challenge_4_workspace
+{
+    struct buffer draws;
+    struct buffer boards;
+    struct buffer winners;
+
+    size_t width;
+    size_t height;
+
+    struct stats* stats;
+};
+
+extern const struct solver challenge_4_solver;
+
+int challenge_4_read(struct bingo_reader* reader, const char* str, const char* last, struct buffer* array, struct buffer* board_numbers);
+size_t find_drawn_on_board(const uint64_t* board, size_t width, size_t height, uint64_t drawn);
+int check_board_row(const uint64_t* board, size_t row_index, size_t width);
+int check_board_column(const uint64_t* board, size_t column_index, size_t width, size_t height);
+void bingo_draw_one(uint64_t drawn, uint64_t* board_numbers, size_t width, size_t height, size_t total_boards, size_t* winners, size_t* total_winners);
+size_t bingo_game(const uint64_t* array, size_t length, uint64_t* board_numbers, size_t width, size_t height, size_t total_boards, size_t* winners, size_t* total_winners);
+uint64_t calculate_unmarked_sum(const uint64_t* board, size_t width, size_t height);
+int challenge_4_reserve(struct challenge_4_workspace* workspace, const size_t* hints);
+
+void challenge_4_init(struct challenge_4_workspace* workspace);
+void challenge_4_free(struct challenge_4_workspace* workspace);
+int challenge_4_parse(const struct input* input, const size_t* hints, struct challenge_4_workspace* workspace);
+int challenge_4_finish(struct challenge_4_workspace* workspace, const size_t* hints, struct solver_answers* answers);
+int challenge_4_load(const struct cache* cache, struct challenge_4_workspace* workspace);
+int challenge_4_store(const char* name, const struct challenge_4_workspace* workspace);
+int challenge_4_solve(const struct input* input, const size_t* hints, struct challenge_4_workspace* workspace, struct solver_answers* answers);
+
+#endif
@@ -1,321 +1,158 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <inttypes.h>
-#include <ctype.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-#include <unistd.h>
-#include <fcntl.h>
-#include <sys/types.h>
-#include <sys/stat.h>
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/stream.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
 
-#define MARKED ((uint64_t) -1)
+#include "challenge_4.h"
 
-void skip_non_digit(char* str, char** end)
+struct stream_context
 {
-    char* a = *end;
+    struct bingo_reader reader;
 
-    while (str != a)
-    {
-        if (isdigit(*str)) break;
-        str += 1;
-    }
+    struct buffer* draws;
+    struct buffer* boards;
 
-    *end = str;
-}
+    struct stats* stats;
+};
 
-void skip_newline(char* str, char** end)
+static const char* consume_chunk(const char* str, const char* last, int final, void* context)
 {
-    char* a = *end;
-
-    char* b = str + 1;
-    char* c = str + 2;
-
-    char* d = str;
+    struct stream_context* c = context;
+    const char* end = last;
 
-    if (str != a && *str == '\n') d = b;    
-    if (str != a && b != a && *str == '\r' && *b == '\n') d = c;
+    if (!final)
+    {
+        const char* line_end = stream_split(str, last, '\n');
+        const char* number_end = stream_split(str, last, ',');
 
-    *end = d;
-}
+        end = line_end > number_end ? line_end : number_end;
+    }
 
-void skip_space(char* str, char** end)
-{
-    char* a = *end;
+    stats_end(c->stats, stats_read);
+    if (challenge_4_read(&c->reader, str, end, c->draws, c->boards) == -1) return NULL;
 
-    while (str != a)
-    {
-        if (!isspace(*str)) break;
-        str += 1;
-    }
+    stats_end(c->stats, stats_parse);
 
-    *end = str;
+    return end;
 }
 
-int read_input(const char* name, uint64_t* array, size_t* length, uint64_t* board_numbers, size_t width, size_t height, size_t* total_boards)
+static int read_stream(const char* name, struct buffer* draws, struct buffer* boards, size_t* width, size_t* height, struct stats* stats)
 {
-    int file = -1;
-    char* mem = NULL;
-    
-    file = open(name, O_RDONLY);
-    if (file == -1) goto cleanup;
+    int file = stream_open(name);
+    if (file == -1) return -1;
 
-    struct stat64 stat;
-    fstat64(file, &stat);
+    struct stream_context context;
+    memset(&context, 0, sizeof(struct stream_context));
 
-    mem = malloc(stat.st_size + 1);
-    if (mem == NULL) goto cleanup;
+    context.draws = draws;
+    context.boards = boards;
+    context.stats = stats;
 
-    size_t mem_index = 0;
-    size_t mem_remaining = stat.st_size;
+    stats_begin(stats);
 
-    while (mem_remaining != 0)
-    {
-        ssize_t chars = read(file, mem + mem_index, mem_remaining);
-        if (chars == -1) goto cleanup;
-
-        mem_index += chars;
-        mem_remaining -= chars;
-    }
-    
-    char* last = mem + mem_index;
-    *last = 0;
+    int result = stream_run(file, consume_chunk, &context);
 
-    char* str = mem;
+    if (*width == 0) *width = context.reader.width;
+    if (*height == 0) *height = context.reader.height;
 
-    size_t index = 0;
-    size_t max_length = *length;
-    
-    while (index < max_length)
-    {
-        char* end;
-
-        end = last;
-        skip_non_digit(str, &end);
-        
-        str = end;
-        
-        end = last;
-        uint64_t value = strtoull(str, &end, 10);
-        
-        if (str != end) array[index++] = value;
-        if (str == last) break;
-        
-        str = end;
-
-        end = last;
-        skip_newline(str, &end);
-        
-        char* temp = str;
-        str = end;
-
-        if (temp != end) break;
-        if (temp == last) break;
-    }
+    stream_close(file);
 
-    *length = index;
-    
-    size_t board_numbers_index = 0;
-    size_t board_numbers_max_length = width * height * (*total_boards);
-    
-    while (board_numbers_index < board_numbers_max_length)
-    {
-        char* end;
-
-        end = last;
-        skip_space(str, &end);
-
-        str = end;
-        
-        end = last;
-        uint64_t value = strtoull(str, &end, 10);
-        
-        if (str != end) board_numbers[board_numbers_index++] = value;
-        if (str == last) break;
-        
-        str = end;
-    }
-    
-    *total_boards = board_numbers_index / (width * height);
-    
-    cleanup: if (file != -1) close(file);
-    if (mem != NULL) free(mem);
-    
-    return file;
+    return result;
 }
 
-size_t find_drawn_on_board(const uint64_t* board, size_t width, size_t height, uint64_t drawn)
+int main(int argc, char** argv)
 {
-    for (size_t index = 0; index < width * height; ++index)
-    {
-        if (board[index] == drawn) return index;
-    }
-
-    return -1;
-}
+    struct stats stats;
+    struct stats* active_stats = NULL;
 
-int check_board_row(const uint64_t* board, size_t row_index, size_t width)
-{
-    size_t count = 0;
-    size_t offset = row_index * width;
+    int write_cache = solver_flag(&argc, argv, "--cache");
 
-    for (size_t index = offset; index < offset + width; ++index)
+    if (solver_flag(&argc, argv, "--stats"))
     {
-        if (board[index] == MARKED) count += 1; 
+        stats_init(&stats);
+        active_stats = &stats;
     }
 
-    return count == width;
-}
+    if (argc < 2) return EXIT_FAILURE;
 
-int check_board_column(const uint64_t* board, size_t column_index, size_t width, size_t height)
-{
-    size_t count = 0;
-    size_t offset = column_index;
+    size_t hints[SOLVER_MAX_HINTS];
+    solver_parse_hints(argc - 2, argv + 2, hints);
 
-    for (size_t index = offset; index < width * height; index += width)
-    {
-        if (board[index] == MARKED) count += 1;
-    }
+    struct solver_answers answers;
 
-    return count == height;
-}
+    struct challenge_4_workspace workspace;
+    challenge_4_init(&workspace);
 
-void bingo_draw_one(uint64_t drawn, uint64_t* board_numbers, size_t width, size_t height, size_t total_boards, size_t* winners, size_t* total_winners)
-{
-    size_t winner_index = 0;
-    size_t board_size = width * height;
+    int status = EXIT_SUCCESS;
+    int result = 0;
 
-    for (size_t board_index = 0; board_index < total_boards; ++board_index)
+    if (stream_wanted(argv[1]))
     {
-        uint64_t* board = &board_numbers[board_index * board_size];
-        size_t drawn_index = find_drawn_on_board(board, width, height, drawn);
-
-        if (drawn_index >= board_size) continue;
-        board[drawn_index] = MARKED;
-
-        size_t row_index = drawn_index / width;
-        size_t column_index = drawn_index % width;
-        
-        if (check_board_row(board, row_index, width) || check_board_column(board, column_index, width, height))
-        {
-             winners[winner_index++] = board_index;        
-        }
-    }
+        result = challenge_4_reserve(&workspace, hints);
 
-    *total_winners = winner_index;
-}
+        if (result != -1) result = read_stream(argv[1], &workspace.draws, &workspace.boards, &workspace.width, &workspace.height, active_stats);
+        if (result != -1) result = challenge_4_finish(&workspace, hints, &answers);
 
-size_t bingo_game(const uint64_t* array, size_t length, uint64_t* board_numbers, size_t width, size_t height, size_t total_boards, size_t* winners, size_t* total_winners)
-{
-    for (size_t index = 0; index < length; ++index)
-    {
-        uint64_t drawn = array[index];
-        bingo_draw_one(drawn, board_numbers, width, height, total_boards, winners, total_winners);
-   
-        if (*total_winners > 0) return index;
+        stats_end(active_stats, stats_solve);
     }
-    
-    return length;
-}
-
-uint64_t calculate_unmarked_sum(const uint64_t* board, size_t width, size_t height)
-{
-    uint64_t sum = 0;
-    size_t board_size = width * height;
-
-    for (size_t index = 0; index < board_size; ++index)
+    else
     {
-        uint64_t number = board[index];
-        if (number != MARKED) sum += number;
-    }
-    
-    return sum;
-}
+        struct cache cache;
+        struct input input;
 
-int main(int argc, char** argv)
-{
-    if (argc < 6) return EXIT_FAILURE;
+        stats_begin(active_stats);
 
-    uint64_t* array = NULL;
-    uint64_t* board_numbers = NULL;
-    size_t* winners = NULL;
+        if (cache_open(argv[1], 4, &cache) == 0)
+        {
+            stats_end(active_stats, stats_read);
 
-    size_t length = strtoull(argv[2], NULL, 10); 
+            result = challenge_4_load(&cache, &workspace);
+            cache_close(&cache);
+        }
+        else
+        {
+            if (input_open(argv[1], &input) == -1)
+            {
+                perror("Failed to read input file");
+                status = EXIT_FAILURE;
+                goto cleanup;
+            }
 
-    size_t width = strtoull(argv[3], NULL, 10);
-    size_t height = strtoull(argv[4], NULL, 10);
+            stats_end(active_stats, stats_read);
 
-    size_t total_boards = strtoull(argv[5], NULL, 10);
+            result = challenge_4_parse(&input, hints, &workspace);
+            input_close(&input);
 
-    array = malloc(length * sizeof(uint64_t));
-    if (array == NULL) goto cleanup;
+            if (result != -1 && write_cache && challenge_4_store(argv[1], &workspace) == -1) perror("Failed to write cache");
+        }
 
-    size_t board_size = width * height;
+        stats_end(active_stats, stats_parse);
 
-    board_numbers = malloc(board_size * total_boards * sizeof(uint64_t));
-    if (board_numbers == NULL) goto cleanup;
-    
-    if (read_input(argv[1], array, &length, board_numbers, width, height, &total_boards) == -1)
-    {
-        perror("Failed to read input file");
-        return EXIT_FAILURE;
+        if (result != -1) result = challenge_4_finish(&workspace, hints, &answers);
+        stats_end(active_stats, stats_solve);
     }
-    
-    winners = malloc(total_boards * sizeof(size_t));
-    if (winners == NULL) goto cleanup;
 
-    size_t total_winners;
-    size_t last_drawn_index = bingo_game(array, length, board_numbers, width, height, total_boards, winners, &total_winners);
-    
-    uint64_t last_drawn_1 = 0;
-    if (last_drawn_index < length) last_drawn_1 = array[last_drawn_index];
-    
-    uint64_t unmarked_sum_1 = 0;
-    
-    if (total_winners >= 1)
-    {
-        size_t board_numbers_index = winners[0] * board_size;
-        unmarked_sum_1 = calculate_unmarked_sum(&board_numbers[board_numbers_index], width, height);
-    }
-    
-    while (last_drawn_index != length && total_boards > 1)
+    if (result == -1)
     {
-        for (size_t winner_index = 0; winner_index < total_winners; ++winner_index)
-        {
-            total_boards -= 1;
-
-            size_t index_1 = winners[winner_index] * board_size;
-            size_t index_2 = total_boards * board_size;
-
-            for (size_t offset = 0; offset < board_size; ++offset)
-            {
-                uint64_t temp = board_numbers[index_1 + offset];
-                
-                board_numbers[index_1 + offset] = board_numbers[index_2 + offset];
-                board_numbers[index_2 + offset] = temp;
-            }
-        }
-
-        size_t a = last_drawn_index + 1;
-        size_t b = bingo_game(&array[a], length - a, board_numbers, width, height, total_boards, winners, &total_winners);
-        
-        last_drawn_index = a + b;
+        perror("Failed to parse input file");
+        status = EXIT_FAILURE;
+        goto cleanup;
     }
 
-    uint64_t last_drawn_2 = 0;
-    if (last_drawn_index < length) last_drawn_2 = array[last_drawn_index];
-
-    uint64_t unmarked_sum_2 = 0;
-    if (total_boards >= 1) unmarked_sum_2 = calculate_unmarked_sum(board_numbers, width, height);
-    
-    printf("ANSWER PART I: %" PRIu64 "\n", last_drawn_1 * unmarked_sum_1);
-    printf("ANSWER PART II: %" PRIu64 "\n", last_drawn_2 * unmarked_sum_2);
+    solver_print(&answers);
+    if (active_stats != NULL) stats_print(active_stats, 4);
     
-    cleanup: if (array != NULL) free(array);
-    if (board_numbers != NULL) free(board_numbers);
-    if (winners != NULL) free(winners);
+    cleanup: challenge_4_free(&workspace);
+    if (active_stats != NULL) stats_free(active_stats);
     
-    return EXIT_SUCCESS;
+    return status;
 }
@@ -0,0 +1,347 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/scan.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+#include "challenge_5.h"
+
+union line_array
+{
+    struct line line;
+    double array[4];
+};
+
+int challenge_5_read(const char* str, const char* last, struct buffer* array)
+{
+    while (str != last)
+    {
+        const char* end;
+
+        union line_array line_array;
+        memset(&line_array, 0, sizeof(union line_array));
+        
+        size_t value_index = 0;
+        
+        for (size_t value_index = 0; value_index < sizeof(union line_array) / sizeof(double); ++value_index)
+        {
+            end = last;
+            scan_non_digit(str, &end);
+            
+            str = end;
+            
+            end = last;
+            uint64_t value = scan_decimal(str, &end);
+            
+            if (str != end) line_array.array[value_index] = (double) value;
+            if (str == last) break;
+            
+            str = end;
+        }
+        
+        if (str != last)
+        {
+            struct line* slot = buffer_push(array);
+            if (slot == NULL) return -1;
+
+            *slot = line_array.line;
+        }
+
+        if (str == last) break;
+    }
+    
+    return 0;
+}
+
+static int read_input(const struct input* input, struct buffer* array)
+{
+    return challenge_5_read(input->begin, input->end, array);
+}
+
+int measure_canvas(const struct line* array, size_t length, size_t* canvas_width, size_t* canvas_height)
+{
+    double max_x = -1;
+    double max_y = -1;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        const struct line* line = &array[index];
+
+        max_x = fmax(max_x, fmax(line->start.x, line->end.x));
+        max_y = fmax(max_y, fmax(line->start.y, line->end.y));
+    }
+
+    if (max_x >= (double) SIZE_MAX || max_y >= (double) SIZE_MAX)
+    {
+        errno = ERANGE;
+        return -1;
+    }
+
+    *canvas_width = (size_t) (max_x + 1);
+    *canvas_height = (size_t) (max_y + 1);
+
+    return 0;
+}
+
+size_t ceil_up(size_t value, size_t multiple)
+{
+    size_t remainder = value % multiple;
+
+    if (remainder != 0)
+    {
+        value += multiple;
+        value -= remainder;
+    }
+    
+    return value;
+}
+
+int measure_canvas_words(size_t canvas_width, size_t canvas_height, size_t* canvas_words)
+{
+    size_t word_bits = sizeof(uint64_t) * CHAR_BIT;
+    size_t canvas_area;
+
+    if (__builtin_mul_overflow(canvas_width, canvas_height, &canvas_area) || canvas_area > SIZE_MAX - word_bits)
+    {
+        errno = ERANGE;
+        return -1;
+    }
+
+    *canvas_words = ceil_up(canvas_area, word_bits) / word_bits;
+
+    return 0;
+}
+
+size_t draw_one_line(uint64_t* canvas, uint64_t* other_canvas, size_t canvas_width, size_t canvas_height, const struct line* line)
+{
+    size_t count = 0;
+    
+    struct vector_2 start = line->start;
+    struct vector_2 end = line->end;
+
+    double direction_x = end.x - start.x;
+    double direction_y = end.y - start.y;
+
+    double mag = hypot(direction_x, direction_y);
+
+    double unit_x = round(direction_x / mag);
+    double unit_y = round(direction_y / mag);
+    
+    double x = start.x;
+    double y = start.y;
+
+    size_t word_bits = sizeof(uint64_t) * CHAR_BIT;
+
+    while (1)
+    {
+        size_t bit_index = (size_t) round(y) * canvas_width + (size_t) round(x);
+        
+        size_t index = bit_index / word_bits;
+        size_t shift = bit_index % word_bits;
+        
+        uint64_t word_1 = canvas[index];
+        int bit_1 = (word_1 >> shift) & 1;
+
+        uint64_t word_2 = other_canvas[index];
+        int bit_2 = (word_2 >> shift) & 1;
+        
+        uint64_t set = (uint64_t) 1 << shift;
+        if (!bit_1) canvas[index] = word_1 | set; 
+        
+        if (bit_1 && !bit_2)
+        {
+            count += 1;
+            other_canvas[index] = word_2 | set;
+        }
+        
+        double diff_x = end.x - x;
+        double diff_y = end.y - y;
+        
+        if (round(diff_x) == 0 && round(diff_y) == 0) break;
+
+        x += unit_x;
+        y += unit_y;
+    }
+    
+    return count;
+}
+
+void print_canvas(const uint64_t* canvas, size_t canvas_width, size_t canvas_height)
+{
+    size_t word_bits = sizeof(uint64_t) * CHAR_BIT;
+
+    for (size_t y = 0; y < canvas_height; ++y)
+    {
+        for (size_t x = 0; x < canvas_width; ++x)
+        {
+            size_t bit_index = y * canvas_width + x;
+
+            size_t index = bit_index / word_bits;
+            size_t shift = bit_index % word_bits;
+
+            uint64_t word = canvas[index];
+            int bit = (word >> shift) & 1;
+
+            switch (bit)
+            {
+                case 0: printf("⬜"); break;
+                case 1: printf("⬛"); break;
+            }
+        }
+        
+        printf("\n");
+    }
+}
+
+int challenge_5_finish(struct challenge_5_workspace* workspace, const size_t* hints, struct solver_answers* answers)
+{
+    size_t hint_width = hints[1];
+    size_t hint_height = hints[2];
+
+    struct line* array = workspace->lines.data;
+    size_t length = workspace->lines.length;
+
+    size_t canvas_width = 0;
+    size_t canvas_height = 0;
+
+    if (measure_canvas(array, length, &canvas_width, &canvas_height) == -1) return -1;
+
+    if (hint_width > canvas_width) canvas_width = hint_width;
+    if (hint_height > canvas_height) canvas_height = hint_height;
+
+    size_t canvas_words = 0;
+    if (measure_canvas_words(canvas_width, canvas_height, &canvas_words) == -1) return -1;
+
+    if (buffer_reserve(&workspace->canvas, canvas_words) == -1) return -1;
+    if (buffer_reserve(&workspace->other_canvas, canvas_words) == -1) return -1;
+
+    size_t canvas_mem_bytes = canvas_words * sizeof(uint64_t);
+
+    uint64_t* canvas = workspace->canvas.data;
+    uint64_t* other_canvas = workspace->other_canvas.data;
+
+    memset(canvas, 0, canvas_mem_bytes);
+    memset(other_canvas, 0, canvas_mem_bytes);
+    
+    size_t perpendicular_overlapping_line_points = 0;
+    size_t every_overlapping_line_points = 0;
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        const struct line* line = &array[index];
+        every_overlapping_line_points += draw_one_line(canvas, other_canvas, canvas_width, canvas_height, line);
+    }
+    
+    memset(canvas, 0, canvas_mem_bytes);
+    memset(other_canvas, 0, canvas_mem_bytes);
+
+    for (size_t index = 0; index < length; ++index)
+    {
+        const struct line* line = &array[index];
+
+        struct vector_2 start = line->start;
+        struct vector_2 end = line->end;
+        
+        if (start.x != end.x && start.y != end.y) continue;
+        perpendicular_overlapping_line_points += draw_one_line(canvas, other_canvas, canvas_width, canvas_height, line);
+    }
+
+    solver_set_u64(answers, perpendicular_overlapping_line_points, every_overlapping_line_points);
+
+    return 0;
+}
+
+void challenge_5_init(struct challenge_5_workspace* workspace)
+{
+    buffer_init(&workspace->lines, sizeof(struct line));
+    buffer_init(&workspace->canvas, sizeof(uint64_t));
+    buffer_init(&workspace->other_canvas, sizeof(uint64_t));
+
+    workspace->stats = NULL;
+}
+
+void challenge_5_free(struct challenge_5_workspace* workspace)
+{
+    buffer_free(&workspace->lines);
+    buffer_free(&workspace->canvas);
+    buffer_free(&workspace->other_canvas);
+}
+
+int challenge_5_parse(const struct input* input, const size_t* hints, struct challenge_5_workspace* workspace)
+{
+    struct buffer* lines = &workspace->lines;
+    buffer_clear(lines);
+
+    if (buffer_reserve(lines, hints[0]) == -1) return -1;
+    return read_input(input, lines);
+}
+
+int challenge_5_load(const struct cache* cache, struct challenge_5_workspace* workspace)
+{
+    if (cache->section_sizes[0] % sizeof(struct line) != 0)
+    {
+        errno = ESTALE;
+        return -1;
+    }
+
+    size_t length_0 = cache->section_sizes[0] / sizeof(struct line);
+
+    buffer_clear(&workspace->lines);
+    if (buffer_reserve(&workspace->lines, length_0) == -1) return -1;
+
+    memcpy(workspace->lines.data, cache->sections[0], cache->section_sizes[0]);
+    workspace->lines.length = length_0;
+
+    return 0;
+}
+
+int challenge_5_store(const char* name, const struct challenge_5_workspace* workspace)
+{
+    uint64_t params[CACHE_PARAMS] = {0};
+
+    const void* sections[CACHE_SECTIONS] = {workspace->lines.data, NULL};
+    size_t section_sizes[CACHE_SECTIONS] = {workspace->lines.length * sizeof(struct line), 0};
+
+    return cache_write(name, 5, params, sections, section_sizes);
+}
+
+int challenge_5_solve(const struct input* input, const size_t* hints, struct challenge_5_workspace* workspace, struct solver_answers* answers)
+{
+    stats_begin(workspace->stats);
+    if (challenge_5_parse(input, hints, workspace) == -1) return -1;
+
+    stats_end(workspace->stats, stats_parse);
+
+    int result = challenge_5_finish(workspace, hints, answers);
+    stats_end(workspace->stats, stats_solve);
+
+    return result;
+}
+
+static void init_workspace(void* workspace)
+{
+    challenge_5_init(workspace);
+}
+
+static void free_workspace(void* workspace)
+{
+    challenge_5_free(workspace);
+}
+
+static int solve_input(const struct input* input, const size_t* hints, void* workspace, struct solver_answers* answers)
+{
+    return challenge_5_solve(input, hints, workspace, answers);
+}
+
+const struct solver challenge_5_solver = {"5", sizeof(struct challenge_5_workspace), init_workspace, free_workspace, solve_input};
@@ -0,0 +1,51 @@
+#ifndef CHALLENGE_5_H
+#define CHALLENGE_5_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
+
+struct vector_2
+{
+    double x;
+    double y;
+};
+
+struct line
+{
+    struct vector_2 start;
+    struct vector_2 end;
+};
+
+struct challenge_5_workspace
+{
+    struct buffer lines;
+    struct buffer canvas;
+    struct buffer other_canvas;
+
+    struct stats* stats;
+};
+
+extern const struct solver challenge_5_solver;
+
+int challenge_5_read(const char* str, const char* last, struct buffer* array);
+int measure_canvas(const struct line* array, size_t length, size_t* canvas_width, size_t* canvas_height);
+size_t ceil_up(size_t value, size_t multiple);
+int measure_canvas_words(size_t canvas_width, size_t canvas_height, size_t* canvas_words);
+size_t draw_one_line(uint64_t* canvas, uint64_t* other_canvas, size_t canvas_width, size_t canvas_height, const struct line* line);
+void print_canvas(const uint64_t* canvas, size_t canvas_width, size_t canvas_height);
+
+void challenge_5_init(struct challenge_5_workspace* workspace);
+void challenge_5_free(struct challenge_5_workspace* workspace);
+int challenge_5_parse(const struct input* input, const size_t* hints, struct challenge_5_workspace* workspace);
+int challenge_5_finish(struct challenge_5_workspace* workspace, const size_t* hints, struct solver_answers* answers);
+int challenge_5_load(const struct cache* cache, struct challenge_5_workspace* workspace);
+int challenge_5_store(const char* name, const struct challenge_5_workspace* workspace);
+int challenge_5_solve(const struct input* input, const size_t* hints, struct challenge_5_workspace* workspace, struct solver_answers* answers);
+
+#endif
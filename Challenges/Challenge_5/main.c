@@ -2,282 +2,233 @@
 #include <stdint.h>
 #include <inttypes.h>
 #include <limits.h>
-#include <ctype.h>
 #include <string.h>
-#include <math.h>
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-#include <unistd.h>
-#include <fcntl.h>
-#include <sys/types.h>
-#include <sys/stat.h>
+#include "../Common/input.h"
+#include "../Common/buffer.h"
+#include "../Common/stream.h"
+#include "../Common/solver.h"
+#include "../Common/stats.h"
+#include "../Common/cache.h"
 
-struct vector_2
-{
-    double x;
-    double y;
-};
+#include "challenge_5.h"
 
-struct line
+struct stream_context
 {
-    struct vector_2 start;
-    struct vector_2 end;
-};
+    struct buffer* lines;
 
-union line_array
-{
-    struct line line;
-    double array[4];
+    uint64_t* canvases[4];
+    size_t canvas_width;
+    size_t canvas_height;
+
+    size_t perpendicular_overlapping_line_points;
+    size_t every_overlapping_line_points;
+
+    struct stats* stats;
 };
 
-void skip_non_digit(char* str, char** end)
+static const char* consume_chunk(const char* str, const char* last, int final, void* context)
 {
-    char* a = *end;
+    struct stream_context* c = context;
+    const char* end = final ? last : stream_split(str, last, '\n');
 
-    while (str != a)
+    stats_end(c->stats, stats_read);
+
+    if (c->canvases[0] == NULL)
     {
-        if (isdigit(*str)) break;
-        str += 1;
-    }
+        if (challenge_5_read(str, end, c->lines) == -1) return NULL;
 
-    *end = str;
-}
+        stats_end(c->stats, stats_parse);
+        return end;
+    }
 
-int read_input(const char* name, struct line* array, size_t* length)
-{
-    int file = -1;
-    char* mem = NULL;
-    
-    file = open(name, O_RDONLY);
-    if (file == -1) goto cleanup;
+    buffer_clear(c->lines);
+    if (challenge_5_read(str, end, c->lines) == -1) return NULL;
 
-    struct stat64 stat;
-    fstat64(file, &stat);
-    
-    mem = malloc(stat.st_size + 1);
-    if (mem == NULL) goto cleanup;
-    
-    size_t mem_index = 0;
-    size_t mem_remaining = stat.st_size;
+    stats_end(c->stats, stats_parse);
 
-    while (mem_remaining != 0)
-    {
-        ssize_t chars = read(file, mem + mem_index, mem_remaining);
-        if (chars == -1) goto cleanup;
+    const struct line* array = c->lines->data;
+    size_t length = c->lines->length;
 
-        mem_index += chars;
-        mem_remaining -= chars;
-    }
-    
-    char* last = mem + mem_index;
-    *last = 0;
+    size_t line_width = 0;
+    size_t line_height = 0;
 
-    char* str = mem;
+    if (measure_canvas(array, length, &line_width, &line_height) == -1) return NULL;
 
-    size_t index = 0;
-    size_t max_length = *length;
-    
-    while (index < max_length)
+    if (line_width > c->canvas_width || line_height > c->canvas_height)
     {
-        char* end;
-
-        union line_array line_array;
-        memset(&line_array, 0, sizeof(union line_array));
-        
-        size_t value_index = 0;
-        
-        for (size_t value_index = 0; value_index < sizeof(union line_array) / sizeof(double); ++value_index)
-        {
-            end = last;
-            skip_non_digit(str, &end);
-            
-            str = end;
-            
-            end = last;
-            uint64_t value = strtoull(str, &end, 10);
-            
-            if (str != end) line_array.array[value_index] = (double) value;
-            if (str == last) break;
-            
-            str = end;
-        }
-        
-        if (str != last) array[index++] = line_array.line;
-        if (str == last) break;
+        errno = ERANGE;
+        return NULL;
     }
-    
-    *length = index;
-    
-    cleanup: if (file != -1) close(file);
-    if (mem != NULL) free(mem);
-    
-    return file;
-}
 
-size_t ceil_up(size_t value, size_t multiple)
-{
-    size_t remainder = value % multiple;
-
-    if (remainder != 0)
+    for (size_t index = 0; index < length; ++index)
     {
-        value += multiple;
-        value -= remainder;
+        const struct line* line = &array[index];
+
+        struct vector_2 start = line->start;
+        struct vector_2 end = line->end;
+
+        c->every_overlapping_line_points += draw_one_line(c->canvases[0], c->canvases[1], c->canvas_width, c->canvas_height, line);
+
+        if (start.x != end.x && start.y != end.y) continue;
+        c->perpendicular_overlapping_line_points += draw_one_line(c->canvases[2], c->canvases[3], c->canvas_width, c->canvas_height, line);
     }
-    
-    return value;
+
+    stats_end(c->stats, stats_solve);
+
+    return end;
 }
 
-size_t draw_one_line(uint64_t* canvas, uint64_t* other_canvas, size_t canvas_width, size_t canvas_height, const struct line* line)
+static int solve_stream(const char* name, struct stream_context* context)
 {
-    size_t count = 0;
-    
-    struct vector_2 start = line->start;
-    struct vector_2 end = line->end;
+    int file = stream_open(name);
+    if (file == -1) return -1;
 
-    double direction_x = end.x - start.x;
-    double direction_y = end.y - start.y;
+    stats_begin(context->stats);
 
-    double mag = hypot(direction_x, direction_y);
+    int result = stream_run(file, consume_chunk, context);
+    stream_close(file);
 
-    double unit_x = round(direction_x / mag);
-    double unit_y = round(direction_y / mag);
-    
-    double x = start.x;
-    double y = start.y;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    struct stats stats;
+    struct stats* active_stats = NULL;
 
-    size_t word_bits = sizeof(uint64_t) * CHAR_BIT;
+    int write_cache = solver_flag(&argc, argv, "--cache");
 
-    while (1)
+    if (solver_flag(&argc, argv, "--stats"))
     {
-        size_t bit_index = (size_t) round(y) * canvas_width + (size_t) round(x);
-        
-        size_t index = bit_index / word_bits;
-        size_t shift = bit_index % word_bits;
-        
-        uint64_t word_1 = canvas[index];
-        int bit_1 = (word_1 >> shift) & 1;
-
-        uint64_t word_2 = other_canvas[index];
-        int bit_2 = (word_2 >> shift) & 1;
-        
-        uint64_t set = (uint64_t) 1 << shift;
-        if (!bit_1) canvas[index] = word_1 | set; 
-        
-        if (bit_1 && !bit_2)
-        {
-            count += 1;
-            other_canvas[index] = word_2 | set;
-        }
-        
-        double diff_x = end.x - x;
-        double diff_y = end.y - y;
-        
-        if (round(diff_x) == 0 && round(diff_y) == 0) break;
-
-        x += unit_x;
-        y += unit_y;
+        stats_init(&stats);
+        active_stats = &stats;
     }
-    
-    return count;
-}
 
-void print_canvas(const uint64_t* canvas, size_t canvas_width, size_t canvas_height)
-{
-    size_t word_bits = sizeof(uint64_t) * CHAR_BIT;
+    if (argc < 2) return EXIT_FAILURE;
 
-    for (size_t y = 0; y < canvas_height; ++y)
+    size_t hints[SOLVER_MAX_HINTS];
+    solver_parse_hints(argc - 2, argv + 2, hints);
+
+    struct solver_answers answers;
+
+    struct challenge_5_workspace workspace;
+    challenge_5_init(&workspace);
+
+    struct stream_context context;
+    memset(&context, 0, sizeof(struct stream_context));
+
+    context.lines = &workspace.lines;
+    context.stats = active_stats;
+
+    size_t hint_width = hints[1];
+    size_t hint_height = hints[2];
+
+    int status = EXIT_SUCCESS;
+    int result = 0;
+
+    if (stream_wanted(argv[1]) && hint_width != 0 && hint_height != 0)
     {
-        for (size_t x = 0; x < canvas_width; ++x)
-        {
-            size_t bit_index = y * canvas_width + x;
+        size_t canvas_words = 0;
 
-            size_t index = bit_index / word_bits;
-            size_t shift = bit_index % word_bits;
+        if (measure_canvas_words(hint_width, hint_height, &canvas_words) == -1)
+        {
+            perror("Failed to size canvas");
+            status = EXIT_FAILURE;
+            goto cleanup;
+        }
 
-            uint64_t word = canvas[index];
-            int bit = (word >> shift) & 1;
+        for (size_t index = 0; index < 4; ++index)
+        {
+            context.canvases[index] = calloc(canvas_words, sizeof(uint64_t));
 
-            switch (bit)
+            if (context.canvases[index] == NULL)
             {
-                case 0: printf("⬜"); break;
-                case 1: printf("⬛"); break;
+                perror("Failed to allocate canvas");
+                status = EXIT_FAILURE;
+                goto cleanup;
             }
         }
-        
-        printf("\n");
-    }
-}
 
-int main(int argc, char** argv)
-{
-    if (argc < 5) return EXIT_FAILURE;
+        context.canvas_width = hint_width;
+        context.canvas_height = hint_height;
 
-    struct line* array = NULL;
+        if (solve_stream(argv[1], &context) == -1)
+        {
+            perror("Failed to parse input stream");
+            status = EXIT_FAILURE;
+            goto cleanup;
+        }
 
-    uint64_t* canvas = NULL;
-    uint64_t* other_canvas = NULL;
+        solver_set_u64(&answers, context.perpendicular_overlapping_line_points, context.every_overlapping_line_points);
+    }
+    else if (stream_wanted(argv[1]))
+    {
+        result = buffer_reserve(&workspace.lines, hints[0]);
 
-    size_t length = strtoull(argv[2], NULL, 10);
+        if (result != -1) result = solve_stream(argv[1], &context);
+        if (result != -1) result = challenge_5_finish(&workspace, hints, &answers);
 
-    size_t canvas_width = strtoull(argv[3], NULL, 10);
-    size_t canvas_height = strtoull(argv[4], NULL, 10);
+        stats_end(active_stats, stats_solve);
+    }
+    else
+    {
+        struct cache cache;
+        struct input input;
 
-    size_t canvas_area = canvas_width * canvas_height;
-    
-    array = malloc(length * sizeof(struct line));
-    if (array == NULL) goto cleanup;
+        stats_begin(active_stats);
 
-    if (read_input(argv[1], array, &length) == -1)
-    {
-        perror("Failed to read input file");
-        return EXIT_FAILURE;
-    }
-    
-    size_t word_size = sizeof(uint64_t) * CHAR_BIT;
-    size_t canvas_mem_bytes = ceil_up(canvas_area, word_size) / CHAR_BIT;
+        if (cache_open(argv[1], 5, &cache) == 0)
+        {
+            stats_end(active_stats, stats_read);
 
-    canvas = malloc(canvas_mem_bytes);
-    if (canvas == NULL) goto cleanup;
+            result = challenge_5_load(&cache, &workspace);
+            cache_close(&cache);
+        }
+        else
+        {
+            if (input_open(argv[1], &input) == -1)
+            {
+                perror("Failed to read input file");
+                status = EXIT_FAILURE;
+                goto cleanup;
+            }
 
-    other_canvas = malloc(canvas_mem_bytes);
-    if (other_canvas == NULL) goto cleanup; 
+            stats_end(active_stats, stats_read);
 
-    memset(canvas, 0, canvas_mem_bytes);
-    memset(other_canvas, 0, canvas_mem_bytes);
-    
-    size_t perpendicular_overlapping_line_points = 0;
-    size_t every_overlapping_line_points = 0;
+            result = challenge_5_parse(&input, hints, &workspace);
+            input_close(&input);
 
-    for (size_t index = 0; index < length; ++index)
-    {
-        const struct line* line = &array[index];
+            if (result != -1 && write_cache && challenge_5_store(argv[1], &workspace) == -1) perror("Failed to write cache");
+        }
 
-        struct vector_2 start = line->start;
-        struct vector_2 end = line->end;
+        stats_end(active_stats, stats_parse);
 
-        every_overlapping_line_points += draw_one_line(canvas, other_canvas, canvas_width, canvas_height, line);
+        if (result != -1) result = challenge_5_finish(&workspace, hints, &answers);
+        stats_end(active_stats, stats_solve);
     }
-    
-    memset(canvas, 0, canvas_mem_bytes);
-    memset(other_canvas, 0, canvas_mem_bytes);
 
-    for (size_t index = 0; index < length; ++index)
+    if (result == -1)
     {
-        const struct line* line = &array[index];
-
-        struct vector_2 start = line->start;
-        struct vector_2 end = line->end;
-        
-        if (start.x != end.x && start.y != end.y) continue;
-        perpendicular_overlapping_line_points += draw_one_line(canvas, other_canvas, canvas_width, canvas_height, line);
+        perror("Failed to parse input file");
+        status = EXIT_FAILURE;
+        goto cleanup;
     }
 
-    printf("ANSWER PART I: %zu\n", perpendicular_overlapping_line_points);
-    printf("ANSWER PART II: %zu\n", every_overlapping_line_points);
+    solver_print(&answers);
+    if (active_stats != NULL) stats_print(active_stats, 5);
     
-    cleanup: if (array != NULL) free(array);
-    if (canvas != NULL) free(canvas);
+    cleanup: challenge_5_free(&workspace);
+
+    for (size_t index = 0; index < 4; ++index)
+    {
+        if (context.canvases[index] != NULL) free(context.canvases[index]);
+    }
+
+    if (active_stats != NULL) stats_free(active_stats);
     
-    return EXIT_SUCCESS;
+    return status;
 }
@@ -0,0 +1,55 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include "buffer.h"
+
+void buffer_init(struct buffer* buffer, size_t element_size)
+{
+    memset(buffer, 0, sizeof(struct buffer));
+    buffer->element_size = element_size;
+}
+
+int buffer_reserve(struct buffer* buffer, size_t capacity)
+{
+    if (capacity <= buffer->capacity) return 0;
+
+    size_t bytes;
+
+    if (__builtin_mul_overflow(capacity, buffer->element_size, &bytes))
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    void* data = realloc(buffer->data, bytes);
+    if (data == NULL) return -1;
+
+    buffer->data = data;
+    buffer->capacity = capacity;
+
+    return 0;
+}
+
+int buffer_grow(struct buffer* buffer)
+{
+    size_t capacity = buffer->capacity * 2;
+    size_t min_capacity = BUFFER_MIN_BYTES / buffer->element_size + 1;
+
+    if (capacity < min_capacity) capacity = min_capacity;
+
+    return buffer_reserve(buffer, capacity);
+}
+
+void buffer_clear(struct buffer* buffer)
+{
+    buffer->length = 0;
+}
+
+void buffer_free(struct buffer* buffer)
+{
+    if (buffer->data != NULL) free(buffer->data);
+    buffer_init(buffer, buffer->element_size);
+}
@@ -0,0 +1,29 @@
+#ifndef COMMON_BUFFER_H
+#define COMMON_BUFFER_H
+
+#include <stddef.h>
+
+#define BUFFER_MIN_BYTES 4096
+
+struct buffer
+{
+    void* data;
+
+    size_t length;
+    size_t capacity;
+    size_t element_size;
+};
+
+void buffer_init(struct buffer* buffer, size_t element_size);
+int buffer_reserve(struct buffer* buffer, size_t capacity);
+int buffer_grow(struct buffer* buffer);
+void buffer_clear(struct buffer* buffer);
+void buffer_free(struct buffer* buffer);
+
+static inline void* buffer_push(struct buffer* buffer)
+{
+    if (buffer->length == buffer->capacity && buffer_grow(buffer) == -1) return NULL;
+    return (char*) buffer->data + buffer->length++ * buffer->element_size;
+}
+
+#endif
@@ -0,0 +1,206 @@
+#define _GNU_SOURCE
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "cache.h"
+
+static int cache_name(const char* name, char* path, size_t size)
+{
+    int length = snprintf(path, size, "%s.cache", name);
+
+    if (length < 0 || (size_t) length >= size)
+    {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+
+    return 0;
+}
+
+static size_t align_up(size_t value)
+{
+    return (value + CACHE_ALIGNMENT - 1) / CACHE_ALIGNMENT * CACHE_ALIGNMENT;
+}
+
+static int newer(const struct stat64* a, const struct stat64* b)
+{
+    if (a->st_mtim.tv_sec != b->st_mtim.tv_sec) return a->st_mtim.tv_sec > b->st_mtim.tv_sec;
+    return a->st_mtim.tv_nsec >= b->st_mtim.tv_nsec;
+}
+
+static int write_full(int file, const void* data, size_t size)
+{
+    size_t length = 0;
+
+    while (length < size)
+    {
+        ssize_t chars = write(file, (const char*) data + length, size - length);
+
+        if (chars == -1 && errno == EINTR) continue;
+        if (chars == -1) return -1;
+
+        length += chars;
+    }
+
+    return 0;
+}
+
+int cache_open(const char* name, int challenge, struct cache* cache)
+{
+    int file = -1;
+    int result = -1;
+
+    void* mapping = MAP_FAILED;
+    size_t mapping_size = 0;
+
+    char path[4096];
+
+    memset(cache, 0, sizeof(struct cache));
+
+    if (cache_name(name, path, sizeof(path)) == -1) goto cleanup;
+
+    struct stat64 input_stat;
+    if (stat64(name, &input_stat) == -1) goto cleanup;
+
+    file = open(path, O_RDONLY);
+    if (file == -1) goto cleanup;
+
+    struct stat64 stat;
+    if (fstat64(file, &stat) == -1) goto cleanup;
+
+    if (!newer(&stat, &input_stat) || (size_t) stat.st_size < sizeof(struct cache_header))
+    {
+        errno = ESTALE;
+        goto cleanup;
+    }
+
+    mapping_size = stat.st_size;
+
+    mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+    if (mapping == MAP_FAILED) goto cleanup;
+
+    const struct cache_header* header = mapping;
+
+    if (memcmp(header->magic, CACHE_MAGIC, sizeof(header->magic)) != 0 || header->version != CACHE_VERSION || header->challenge != (uint32_t) challenge)
+    {
+        errno = ESTALE;
+        goto cleanup;
+    }
+
+    size_t offset = align_up(sizeof(struct cache_header));
+
+    for (size_t index = 0; index < CACHE_SECTIONS; ++index)
+    {
+        size_t size = header->section_sizes[index];
+
+        if (size > mapping_size || offset > mapping_size - size)
+        {
+            errno = ESTALE;
+            goto cleanup;
+        }
+
+        cache->sections[index] = (const char*) mapping + offset;
+        cache->section_sizes[index] = size;
+
+        offset = align_up(offset + size);
+    }
+
+    memcpy(cache->params, header->params, sizeof(cache->params));
+
+    madvise(mapping, mapping_size, MADV_WILLNEED);
+
+    cache->mapping = mapping;
+    cache->mapping_size = mapping_size;
+
+    result = 0;
+
+    cleanup: if (file != -1) close(file);
+
+    if (result == -1 && mapping != MAP_FAILED)
+    {
+        int error = errno;
+        munmap(mapping, mapping_size);
+        errno = error;
+    }
+
+    if (result == -1) memset(cache, 0, sizeof(struct cache));
+
+    return result;
+}
+
+void cache_close(struct cache* cache)
+{
+    if (cache->mapping != NULL) munmap(cache->mapping, cache->mapping_size);
+    memset(cache, 0, sizeof(struct cache));
+}
+
+int cache_write(const char* name, int challenge, const uint64_t* params, const void* const* sections, const size_t* section_sizes)
+{
+    int file = -1;
+    int result = -1;
+
+    char path[4096];
+    char temporary[4096 + 16];
+
+    if (cache_name(name, path, sizeof(path)) == -1) goto cleanup;
+    snprintf(temporary, sizeof(temporary), "%s.XXXXXX", path);
+
+    file = mkstemp(temporary);
+    if (file == -1) goto cleanup;
+
+    struct cache_header header;
+    memset(&header, 0, sizeof(struct cache_header));
+
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_VERSION;
+    header.challenge = challenge;
+
+    memcpy(header.params, params, sizeof(header.params));
+
+    for (size_t index = 0; index < CACHE_SECTIONS; ++index)
+    {
+        header.section_sizes[index] = section_sizes[index];
+    }
+
+    static const char padding[CACHE_ALIGNMENT];
+
+    size_t offset = sizeof(struct cache_header);
+    if (write_full(file, &header, offset) == -1) goto cleanup;
+
+    for (size_t index = 0; index < CACHE_SECTIONS; ++index)
+    {
+        size_t aligned = align_up(offset);
+
+        if (write_full(file, padding, aligned - offset) == -1) goto cleanup;
+        if (write_full(file, sections[index], section_sizes[index]) == -1) goto cleanup;
+
+        offset = aligned + section_sizes[index];
+    }
+
+    if (fchmod(file, 0644) == -1) goto cleanup;
+    if (rename(temporary, path) == -1) goto cleanup;
+
+    result = 0;
+
+    cleanup: if (file != -1) close(file);
+
+    if (result == -1 && file != -1)
+    {
+        int error = errno;
+        unlink(temporary);
+        errno = error;
+    }
+
+    return result;
+}
@@ -0,0 +1,39 @@
+#ifndef COMMON_CACHE_H
+#define COMMON_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CACHE_MAGIC "AOCCACHE"
+#define CACHE_VERSION 2
+#define CACHE_ALIGNMENT 64
+
+#define CACHE_PARAMS 4
+#define CACHE_SECTIONS 2
+
+struct cache_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t challenge;
+
+    uint64_t params[CACHE_PARAMS];
+    uint64_t section_sizes[CACHE_SECTIONS];
+};
+
+struct cache
+{
+    void* mapping;
+    size_t mapping_size;
+
+    uint64_t params[CACHE_PARAMS];
+
+    const void* sections[CACHE_SECTIONS];
+    size_t section_sizes[CACHE_SECTIONS];
+};
+
+int cache_open(const char* name, int challenge, struct cache* cache);
+void cache_close(struct cache* cache);
+int cache_write(const char* name, int challenge, const uint64_t* params, const void* const* sections, const size_t* section_sizes);
+
+#endif
@@ -0,0 +1,73 @@
+#define _GNU_SOURCE
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "input.h"
+
+int input_open(const char* name, struct input* input)
+{
+    int file = -1;
+    int result = -1;
+
+    char* mapping = MAP_FAILED;
+    size_t mapping_size = 0;
+
+    memset(input, 0, sizeof(struct input));
+
+    file = open(name, O_RDONLY);
+    if (file == -1) goto cleanup;
+
+    struct stat64 stat;
+    if (fstat64(file, &stat) == -1) goto cleanup;
+
+    size_t size = stat.st_size;
+    size_t page_size = sysconf(_SC_PAGESIZE);
+
+    mapping_size = (size + page_size - 1) / page_size * page_size + page_size;
+
+    mapping = mmap(NULL, mapping_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) goto cleanup;
+
+    if (size != 0)
+    {
+        void* view = mmap(mapping, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, file, 0);
+        if (view == MAP_FAILED) goto cleanup;
+
+        madvise(view, size, MADV_SEQUENTIAL);
+        madvise(view, size, MADV_WILLNEED);
+    }
+
+    input->begin = mapping;
+    input->end = mapping + size;
+
+    input->mapping = mapping;
+    input->mapping_size = mapping_size;
+
+    result = 0;
+
+    cleanup: if (file != -1) close(file);
+
+    if (result == -1 && mapping != MAP_FAILED)
+    {
+        int error = errno;
+        munmap(mapping, mapping_size);
+        errno = error;
+    }
+
+    return result;
+}
+
+void input_close(struct input* input)
+{
+    if (input->mapping != NULL) munmap(input->mapping, input->mapping_size);
+    memset(input, 0, sizeof(struct input));
+}
@@ -0,0 +1,20 @@
+#ifndef COMMON_INPUT_H
+#define COMMON_INPUT_H
+
+#include <stddef.h>
+
+#define INPUT_PADDING 64
+
+struct input
+{
+    const char* begin;
+    const char* end;
+
+    void* mapping;
+    size_t mapping_size;
+};
+
+int input_open(const char* name, struct input* input);
+void input_close(struct input* input);
+
+#endif
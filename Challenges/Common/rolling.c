@@ -0,0 +1,297 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include "buffer.h"
+#include "rolling.h"
+
+#define ROLLING_SLACK 64
+
+enum rolling_side
+{
+    rolling_side_low = 0,
+    rolling_side_high = 1,
+};
+
+struct rolling_entry
+{
+    uint64_t value;
+    size_t position;
+};
+
+static int entry_before(const struct rolling_heap* heap, const struct rolling_entry* a, const struct rolling_entry* b)
+{
+    if (a->value != b->value) return heap->maximum ? a->value > b->value : a->value < b->value;
+    return heap->maximum ? a->position > b->position : a->position < b->position;
+}
+
+static void heap_sift_down(struct rolling_heap* heap, size_t index)
+{
+    struct rolling_entry* entries = heap->entries.data;
+    size_t length = heap->entries.length;
+
+    while (1)
+    {
+        size_t first = index;
+        size_t left = index * 2 + 1;
+        size_t right = left + 1;
+
+        if (left < length && entry_before(heap, &entries[left], &entries[first])) first = left;
+        if (right < length && entry_before(heap, &entries[right], &entries[first])) first = right;
+
+        if (first == index) break;
+
+        struct rolling_entry entry = entries[index];
+        entries[index] = entries[first];
+        entries[first] = entry;
+
+        index = first;
+    }
+}
+
+static int heap_push(struct rolling_heap* heap, uint64_t value, size_t position)
+{
+    struct rolling_entry* slot = buffer_push(&heap->entries);
+    if (slot == NULL) return -1;
+
+    slot->value = value;
+    slot->position = position;
+
+    struct rolling_entry* entries = heap->entries.data;
+    size_t index = heap->entries.length - 1;
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!entry_before(heap, &entries[index], &entries[parent])) break;
+
+        struct rolling_entry entry = entries[index];
+        entries[index] = entries[parent];
+        entries[parent] = entry;
+
+        index = parent;
+    }
+
+    heap->valid += 1;
+
+    return 0;
+}
+
+static struct rolling_entry heap_pop(struct rolling_heap* heap)
+{
+    struct rolling_entry* entries = heap->entries.data;
+    struct rolling_entry top = entries[0];
+
+    entries[0] = entries[--heap->entries.length];
+    heap_sift_down(heap, 0);
+
+    return top;
+}
+
+static int stale(const struct rolling* rolling, size_t position)
+{
+    return position + rolling->size < rolling->total;
+}
+
+static void heap_prune(const struct rolling* rolling, struct rolling_heap* heap)
+{
+    const struct rolling_entry* entries = heap->entries.data;
+
+    while (heap->entries.length != 0 && stale(rolling, entries[0].position))
+    {
+        heap_pop(heap);
+    }
+}
+
+static void heap_compact(const struct rolling* rolling, struct rolling_heap* heap)
+{
+    if (heap->entries.length <= heap->valid * 2 + ROLLING_SLACK) return;
+
+    struct rolling_entry* entries = heap->entries.data;
+    size_t length = 0;
+
+    for (size_t index = 0; index < heap->entries.length; ++index)
+    {
+        if (!stale(rolling, entries[index].position)) entries[length++] = entries[index];
+    }
+
+    heap->entries.length = length;
+
+    for (size_t index = length / 2; index-- > 0;)
+    {
+        heap_sift_down(heap, index);
+    }
+}
+
+static int heap_move(struct rolling* rolling, struct rolling_heap* from, struct rolling_heap* to, enum rolling_side side)
+{
+    struct rolling_entry entry = heap_pop(from);
+
+    from->valid -= 1;
+    rolling->sides[entry.position % rolling->size] = side;
+
+    heap_prune(rolling, from);
+
+    return heap_push(to, entry.value, entry.position);
+}
+
+static void deque_push(const struct rolling* rolling, struct rolling_deque* deque, int maximum)
+{
+    size_t size = rolling->size;
+    size_t position = rolling->total - 1;
+
+    uint64_t value = rolling->values[position % size];
+
+    while (deque->length != 0)
+    {
+        size_t back = deque->positions[(deque->head + deque->length - 1) % size];
+        uint64_t back_value = rolling->values[back % size];
+
+        if (maximum ? back_value > value : back_value < value) break;
+        deque->length -= 1;
+    }
+
+    deque->positions[(deque->head + deque->length) % size] = position;
+    deque->length += 1;
+}
+
+static void deque_expire(const struct rolling* rolling, struct rolling_deque* deque)
+{
+    if (deque->length != 0 && stale(rolling, deque->positions[deque->head]))
+    {
+        deque->head = (deque->head + 1) % rolling->size;
+        deque->length -= 1;
+    }
+}
+
+static uint64_t deque_front(const struct rolling* rolling, const struct rolling_deque* deque)
+{
+    return rolling->values[deque->positions[deque->head] % rolling->size];
+}
+
+int rolling_init(struct rolling* rolling, size_t size)
+{
+    memset(rolling, 0, sizeof(struct rolling));
+
+    if (size == 0)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    rolling->size = size;
+
+    buffer_init(&rolling->low.entries, sizeof(struct rolling_entry));
+    buffer_init(&rolling->high.entries, sizeof(struct rolling_entry));
+
+    rolling->low.maximum = 1;
+    rolling->high.maximum = 0;
+
+    rolling->values = malloc(size * sizeof(uint64_t));
+    rolling->sides = malloc(size * sizeof(uint8_t));
+
+    rolling->minimum.positions = malloc(size * sizeof(size_t));
+    rolling->maximum.positions = malloc(size * sizeof(size_t));
+
+    if (rolling->values == NULL || rolling->sides == NULL || rolling->minimum.positions == NULL || rolling->maximum.positions == NULL)
+    {
+        rolling_free(rolling);
+        return -1;
+    }
+
+    return 0;
+}
+
+void rolling_free(struct rolling* rolling)
+{
+    if (rolling->values != NULL) free(rolling->values);
+    if (rolling->sides != NULL) free(rolling->sides);
+
+    if (rolling->minimum.positions != NULL) free(rolling->minimum.positions);
+    if (rolling->maximum.positions != NULL) free(rolling->maximum.positions);
+
+    buffer_free(&rolling->low.entries);
+    buffer_free(&rolling->high.entries);
+
+    rolling->values = NULL;
+    rolling->sides = NULL;
+    rolling->minimum.positions = NULL;
+    rolling->maximum.positions = NULL;
+}
+
+int rolling_push(struct rolling* rolling, uint64_t value, struct rolling_result* result)
+{
+    size_t size = rolling->size;
+    size_t position = rolling->total;
+    size_t slot = position % size;
+
+    if (position >= size)
+    {
+        rolling->sum -= rolling->values[slot];
+
+        if (rolling->sides[slot] == rolling_side_low) rolling->low.valid -= 1;
+        else rolling->high.valid -= 1;
+    }
+
+    rolling->values[slot] = value;
+    rolling->sum += value;
+    rolling->total += 1;
+
+    deque_expire(rolling, &rolling->minimum);
+    deque_expire(rolling, &rolling->maximum);
+
+    deque_push(rolling, &rolling->minimum, 0);
+    deque_push(rolling, &rolling->maximum, 1);
+
+    struct rolling_heap* low = &rolling->low;
+    struct rolling_heap* high = &rolling->high;
+
+    heap_prune(rolling, low);
+    heap_prune(rolling, high);
+
+    const struct rolling_entry* low_entries = low->entries.data;
+    const struct rolling_entry* high_entries = high->entries.data;
+
+    int lower = high->entries.length == 0 || value <= high_entries[0].value;
+    if (low->entries.length != 0) lower = value <= low_entries[0].value;
+
+    if (lower)
+    {
+        rolling->sides[slot] = rolling_side_low;
+        if (heap_push(low, value, position) == -1) return -1;
+    }
+    else
+    {
+        rolling->sides[slot] = rolling_side_high;
+        if (heap_push(high, value, position) == -1) return -1;
+    }
+
+    while (low->valid > high->valid + 1)
+    {
+        if (heap_move(rolling, low, high, rolling_side_high) == -1) return -1;
+    }
+
+    while (high->valid > low->valid)
+    {
+        if (heap_move(rolling, high, low, rolling_side_low) == -1) return -1;
+    }
+
+    heap_prune(rolling, low);
+    heap_prune(rolling, high);
+
+    heap_compact(rolling, low);
+    heap_compact(rolling, high);
+
+    if (rolling->total < size) return 0;
+
+    low_entries = low->entries.data;
+
+    result->minimum = deque_front(rolling, &rolling->minimum);
+    result->maximum = deque_front(rolling, &rolling->maximum);
+    result->sum = rolling->sum;
+    result->median = low_entries[0].value;
+
+    return 1;
+}
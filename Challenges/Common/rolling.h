@@ -0,0 +1,54 @@
+#ifndef COMMON_ROLLING_H
+#define COMMON_ROLLING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "buffer.h"
+
+struct rolling_deque
+{
+    size_t* positions;
+
+    size_t head;
+    size_t length;
+};
+
+struct rolling_heap
+{
+    struct buffer entries;
+
+    size_t valid;
+    int maximum;
+};
+
+struct rolling
+{
+    size_t size;
+    size_t total;
+
+    uint64_t* values;
+    uint8_t* sides;
+
+    struct rolling_deque minimum;
+    struct rolling_deque maximum;
+
+    uint64_t sum;
+
+    struct rolling_heap low;
+    struct rolling_heap high;
+};
+
+struct rolling_result
+{
+    uint64_t minimum;
+    uint64_t maximum;
+    uint64_t sum;
+    uint64_t median;
+};
+
+int rolling_init(struct rolling* rolling, size_t size);
+void rolling_free(struct rolling* rolling);
+int rolling_push(struct rolling* rolling, uint64_t value, struct rolling_result* result);
+
+#endif
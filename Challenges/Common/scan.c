@@ -0,0 +1,251 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCAN_X86 1
+#else
+#define SCAN_X86 0
+#endif
+
+#include "scan.h"
+
+struct scan_functions
+{
+    const char* (*non_digit)(const char* str, const char* last);
+    const char* (*digit)(const char* str, const char* last);
+};
+
+static int is_digit(char c)
+{
+    return (unsigned char) (c - '0') <= 9;
+}
+
+static uint64_t convert_eight_digits(const char* str)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    uint64_t value;
+    memcpy(&value, str, sizeof(uint64_t));
+
+    value = ((value & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+    value = ((value & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+    value = ((value & 0x0000FFFF0000FFFF) * 42949672960001) >> 32;
+
+    return value;
+#else
+    uint64_t value = 0;
+    for (size_t index = 0; index < 8; ++index) value = value * 10 + (str[index] - '0');
+
+    return value;
+#endif
+}
+
+static uint64_t convert_digits(const char* str, size_t length)
+{
+    uint64_t value = 0;
+    size_t head = length % 8;
+
+    for (size_t index = 0; index < head; ++index)
+    {
+        value = value * 10 + (str[index] - '0');
+    }
+
+    for (size_t index = head; index < length; index += 8)
+    {
+        uint64_t chunk = convert_eight_digits(str + index);
+
+        if (__builtin_mul_overflow(value, 100000000, &value)) return UINT64_MAX;
+        if (__builtin_add_overflow(value, chunk, &value)) return UINT64_MAX;
+    }
+
+    return value;
+}
+
+static const char* non_digit_scalar(const char* str, const char* last)
+{
+    while (str != last)
+    {
+        if (is_digit(*str)) break;
+        str += 1;
+    }
+
+    return str;
+}
+
+static const char* digit_scalar(const char* str, const char* last)
+{
+    while (str != last)
+    {
+        if (!is_digit(*str)) break;
+        str += 1;
+    }
+
+    return str;
+}
+
+#if SCAN_X86
+
+__attribute__((target("sse2")))
+static uint32_t digit_mask_sse2(const char* str)
+{
+    __m128i zero = _mm_set1_epi8('0');
+    __m128i nine = _mm_set1_epi8(9);
+
+    __m128i low = _mm_sub_epi8(_mm_loadu_si128((const __m128i*) str), zero);
+    __m128i high = _mm_sub_epi8(_mm_loadu_si128((const __m128i*) (str + 16)), zero);
+
+    low = _mm_cmpeq_epi8(_mm_min_epu8(low, nine), low);
+    high = _mm_cmpeq_epi8(_mm_min_epu8(high, nine), high);
+
+    return (uint32_t) _mm_movemask_epi8(low) | (uint32_t) _mm_movemask_epi8(high) << 16;
+}
+
+__attribute__((target("sse2")))
+static const char* non_digit_sse2(const char* str, const char* last)
+{
+    while (str < last)
+    {
+        uint32_t mask = digit_mask_sse2(str);
+
+        if (mask != 0)
+        {
+            str += __builtin_ctz(mask);
+            break;
+        }
+
+        str += SCAN_BLOCK;
+    }
+
+    return str < last ? str : last;
+}
+
+__attribute__((target("sse2")))
+static const char* digit_sse2(const char* str, const char* last)
+{
+    while (str < last)
+    {
+        uint32_t mask = ~digit_mask_sse2(str);
+
+        if (mask != 0)
+        {
+            str += __builtin_ctz(mask);
+            break;
+        }
+
+        str += SCAN_BLOCK;
+    }
+
+    return str < last ? str : last;
+}
+
+__attribute__((target("avx2")))
+static uint32_t digit_mask_avx2(const char* str)
+{
+    __m256i zero = _mm256_set1_epi8('0');
+    __m256i nine = _mm256_set1_epi8(9);
+
+    __m256i block = _mm256_sub_epi8(_mm256_loadu_si256((const __m256i*) str), zero);
+    block = _mm256_cmpeq_epi8(_mm256_min_epu8(block, nine), block);
+
+    return (uint32_t) _mm256_movemask_epi8(block);
+}
+
+__attribute__((target("avx2")))
+static const char* non_digit_avx2(const char* str, const char* last)
+{
+    while (str < last)
+    {
+        uint32_t mask = digit_mask_avx2(str);
+
+        if (mask != 0)
+        {
+            str += __builtin_ctz(mask);
+            break;
+        }
+
+        str += SCAN_BLOCK;
+    }
+
+    return str < last ? str : last;
+}
+
+__attribute__((target("avx2")))
+static const char* digit_avx2(const char* str, const char* last)
+{
+    while (str < last)
+    {
+        uint32_t mask = ~digit_mask_avx2(str);
+
+        if (mask != 0)
+        {
+            str += __builtin_ctz(mask);
+            break;
+        }
+
+        str += SCAN_BLOCK;
+    }
+
+    return str < last ? str : last;
+}
+
+#endif
+
+static const struct scan_functions scan_levels[] =
+{
+    [scan_level_scalar] = {non_digit_scalar, digit_scalar},
+#if SCAN_X86
+    [scan_level_sse2] = {non_digit_sse2, digit_sse2},
+    [scan_level_avx2] = {non_digit_avx2, digit_avx2},
+#endif
+};
+
+static const struct scan_functions* scan_selected = NULL;
+static pthread_once_t scan_once = PTHREAD_ONCE_INIT;
+
+static enum scan_level scan_supported(void)
+{
+#if SCAN_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) return scan_level_avx2;
+    if (__builtin_cpu_supports("sse2")) return scan_level_sse2;
+#endif
+
+    return scan_level_scalar;
+}
+
+enum scan_level scan_select(enum scan_level level)
+{
+    enum scan_level supported = scan_supported();
+    if (level > supported) level = supported;
+
+    scan_selected = &scan_levels[level];
+
+    return level;
+}
+
+static void scan_default(void)
+{
+    if (scan_selected == NULL) scan_select(scan_level_avx2);
+}
+
+static const struct scan_functions* scan_functions(void)
+{
+    pthread_once(&scan_once, scan_default);
+    return scan_selected;
+}
+
+void scan_non_digit(const char* str, const char** end)
+{
+    *end = scan_functions()->non_digit(str, *end);
+}
+
+uint64_t scan_decimal(const char* str, const char** end)
+{
+    const char* digits_end = scan_functions()->digit(str, *end);
+    *end = digits_end;
+
+    return convert_digits(str, digits_end - str);
+}
@@ -0,0 +1,21 @@
+#ifndef COMMON_SCAN_H
+#define COMMON_SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SCAN_BLOCK 32
+
+enum scan_level
+{
+    scan_level_scalar = 0,
+    scan_level_sse2 = 1,
+    scan_level_avx2 = 2,
+};
+
+enum scan_level scan_select(enum scan_level level);
+
+void scan_non_digit(const char* str, const char** end);
+uint64_t scan_decimal(const char* str, const char** end);
+
+#endif
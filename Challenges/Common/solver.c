@@ -0,0 +1,206 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "buffer.h"
+#include "solver.h"
+
+#define SOLVER_CHUNK UINT64_C(10000000000000000000)
+#define SOLVER_CHUNK_DIGITS 19
+
+int solver_flag(int* argc, char** argv, const char* flag)
+{
+    int found = 0;
+    int length = 0;
+
+    for (int index = 0; index < *argc; ++index)
+    {
+        if (strcmp(argv[index], flag) == 0) found = 1;
+        else argv[length++] = argv[index];
+    }
+
+    *argc = length;
+
+    return found;
+}
+
+const char* solver_argument(int* argc, char** argv, const char* flag)
+{
+    const char* value = NULL;
+    int length = 0;
+
+    for (int index = 0; index < *argc; ++index)
+    {
+        if (strcmp(argv[index], flag) == 0 && index + 1 < *argc) value = argv[++index];
+        else argv[length++] = argv[index];
+    }
+
+    *argc = length;
+
+    return value;
+}
+
+size_t solver_option(int* argc, char** argv, const char* flag, size_t fallback)
+{
+    const char* value = solver_argument(argc, argv, flag);
+    if (value == NULL) return fallback;
+
+    return strtoull(value, NULL, 10);
+}
+
+int solver_parse_list(const char* str, struct buffer* values)
+{
+    while (*str != '\0')
+    {
+        char* end;
+
+        size_t first = strtoull(str, &end, 10);
+        size_t last = first;
+
+        if (end != str && *end == '-') last = strtoull(end + 1, &end, 10);
+
+        if (end == str || last < first || (*end != ',' && *end != '\0'))
+        {
+            errno = EINVAL;
+            return -1;
+        }
+
+        for (size_t value = first; value <= last; ++value)
+        {
+            size_t* slot = buffer_push(values);
+            if (slot == NULL) return -1;
+
+            *slot = value;
+        }
+
+        str = *end == ',' ? end + 1 : end;
+    }
+
+    return 0;
+}
+
+void solver_parse_hints(int argc, char** argv, size_t* hints)
+{
+    memset(hints, 0, SOLVER_MAX_HINTS * sizeof(size_t));
+
+    for (int index = 0; index < argc && index < SOLVER_MAX_HINTS; ++index)
+    {
+        hints[index] = strtoull(argv[index], NULL, 10);
+    }
+}
+
+void solver_set_u64(struct solver_answers* answers, uint64_t part_1, uint64_t part_2)
+{
+    snprintf(answers->part_1, SOLVER_ANSWER_SIZE, "%" PRIu64, part_1);
+    snprintf(answers->part_2, SOLVER_ANSWER_SIZE, "%" PRIu64, part_2);
+}
+
+void solver_set_i64(struct solver_answers* answers, int64_t part_1, int64_t part_2)
+{
+    snprintf(answers->part_1, SOLVER_ANSWER_SIZE, "%" PRId64, part_1);
+    snprintf(answers->part_2, SOLVER_ANSWER_SIZE, "%" PRId64, part_2);
+}
+
+void solver_format_i128(char* str, size_t size, __int128 value)
+{
+    char digits[48];
+    size_t length = 0;
+
+    unsigned __int128 magnitude = value < 0 ? -(unsigned __int128) value : (unsigned __int128) value;
+
+    do
+    {
+        digits[length++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    }
+    while (magnitude != 0);
+
+    if (value < 0) digits[length++] = '-';
+
+    size_t chars = 0;
+
+    while (length != 0 && chars + 1 < size)
+    {
+        str[chars++] = digits[--length];
+    }
+
+    if (size != 0) str[chars] = '\0';
+}
+
+void solver_set_i128(struct solver_answers* answers, __int128 part_1, __int128 part_2)
+{
+    solver_format_i128(answers->part_1, SOLVER_ANSWER_SIZE, part_1);
+    solver_format_i128(answers->part_2, SOLVER_ANSWER_SIZE, part_2);
+}
+
+int solver_format_words(char* str, size_t size, const uint64_t* words, size_t total_words)
+{
+    int result = -1;
+
+    char* digits = malloc((total_words + 1) * 20);
+    uint64_t* quotient = malloc((total_words + 1) * sizeof(uint64_t));
+
+    if (digits == NULL || quotient == NULL) goto cleanup;
+
+    memcpy(quotient, words, total_words * sizeof(uint64_t));
+
+    size_t top = total_words;
+    size_t length = 0;
+
+    while (top != 0 && quotient[top - 1] == 0) top -= 1;
+
+    do
+    {
+        unsigned __int128 remainder = 0;
+
+        for (size_t index = top; index-- > 0;)
+        {
+            unsigned __int128 current = remainder << 64 | quotient[index];
+
+            quotient[index] = current / SOLVER_CHUNK;
+            remainder = current % SOLVER_CHUNK;
+        }
+
+        while (top != 0 && quotient[top - 1] == 0) top -= 1;
+
+        uint64_t chunk = remainder;
+
+        do
+        {
+            digits[length++] = '0' + chunk % 10;
+            chunk /= 10;
+        }
+        while (chunk != 0 || (top != 0 && length % SOLVER_CHUNK_DIGITS != 0));
+    }
+    while (top != 0);
+
+    if (length >= size)
+    {
+        errno = ERANGE;
+        goto cleanup;
+    }
+
+    for (size_t chars = 0; chars < length; ++chars)
+    {
+        str[chars] = digits[length - chars - 1];
+    }
+
+    str[length] = '\0';
+
+    result = 0;
+
+    cleanup: if (digits != NULL) free(digits);
+    if (quotient != NULL) free(quotient);
+
+    return result;
+}
+
+void solver_print(const struct solver_answers* answers)
+{
+    printf("ANSWER PART I: %s\n", answers->part_1);
+    printf("ANSWER PART II: %s\n", answers->part_2);
+}
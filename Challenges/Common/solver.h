@@ -0,0 +1,41 @@
+#ifndef COMMON_SOLVER_H
+#define COMMON_SOLVER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "input.h"
+#include "buffer.h"
+
+#define SOLVER_MAX_HINTS 4
+#define SOLVER_ANSWER_SIZE 2560
+
+struct solver_answers
+{
+    char part_1[SOLVER_ANSWER_SIZE];
+    char part_2[SOLVER_ANSWER_SIZE];
+};
+
+struct solver
+{
+    const char* name;
+    size_t workspace_size;
+
+    void (*init)(void* workspace);
+    void (*free)(void* workspace);
+    int (*solve)(const struct input* input, const size_t* hints, void* workspace, struct solver_answers* answers);
+};
+
+int solver_flag(int* argc, char** argv, const char* flag);
+const char* solver_argument(int* argc, char** argv, const char* flag);
+size_t solver_option(int* argc, char** argv, const char* flag, size_t fallback);
+int solver_parse_list(const char* str, struct buffer* values);
+void solver_parse_hints(int argc, char** argv, size_t* hints);
+void solver_set_u64(struct solver_answers* answers, uint64_t part_1, uint64_t part_2);
+void solver_set_i64(struct solver_answers* answers, int64_t part_1, int64_t part_2);
+void solver_format_i128(char* str, size_t size, __int128 value);
+void solver_set_i128(struct solver_answers* answers, __int128 part_1, __int128 part_2);
+int solver_format_words(char* str, size_t size, const uint64_t* words, size_t total_words);
+void solver_print(const struct solver_answers* answers);
+
+#endif
@@ -0,0 +1,126 @@
+#define _GNU_SOURCE
+
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "stats.h"
+
+static const char* phase_names[STATS_PHASES] = {"read", "parse", "solve"};
+static const char* counter_names[STATS_COUNTERS] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+
+static const uint64_t counter_configs[STATS_COUNTERS] =
+{
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return (uint64_t) time.tv_sec * 1000000000 + time.tv_nsec;
+}
+
+static int open_counter(uint64_t config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(struct perf_event_attr));
+
+    attr.size = sizeof(struct perf_event_attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.inherit = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void read_counters(const struct stats* stats, uint64_t* counts)
+{
+    for (size_t index = 0; index < STATS_COUNTERS; ++index)
+    {
+        counts[index] = 0;
+
+        if (stats->files[index] == -1) continue;
+        if (read(stats->files[index], &counts[index], sizeof(uint64_t)) != sizeof(uint64_t)) counts[index] = 0;
+    }
+}
+
+void stats_init(struct stats* stats)
+{
+    memset(stats, 0, sizeof(struct stats));
+
+    for (size_t index = 0; index < STATS_COUNTERS; ++index)
+    {
+        stats->files[index] = open_counter(counter_configs[index]);
+    }
+}
+
+void stats_free(struct stats* stats)
+{
+    for (size_t index = 0; index < STATS_COUNTERS; ++index)
+    {
+        if (stats->files[index] != -1) close(stats->files[index]);
+        stats->files[index] = -1;
+    }
+}
+
+void stats_begin(struct stats* stats)
+{
+    if (stats == NULL) return;
+
+    read_counters(stats, stats->start_counts);
+    stats->start_ns = now_ns();
+}
+
+void stats_end(struct stats* stats, enum stats_phase phase)
+{
+    if (stats == NULL) return;
+
+    uint64_t end_ns = now_ns();
+
+    uint64_t counts[STATS_COUNTERS];
+    read_counters(stats, counts);
+
+    stats->elapsed_ns[phase] += end_ns - stats->start_ns;
+
+    for (size_t index = 0; index < STATS_COUNTERS; ++index)
+    {
+        stats->counts[phase][index] += counts[index] - stats->start_counts[index];
+    }
+
+    stats_begin(stats);
+}
+
+void stats_print(const struct stats* stats, int challenge)
+{
+    printf("{\"challenge\":%d", challenge);
+
+    for (size_t phase = 0; phase < STATS_PHASES; ++phase)
+    {
+        printf(",\"%s\":{\"ns\":%" PRIu64, phase_names[phase], stats->elapsed_ns[phase]);
+
+        for (size_t index = 0; index < STATS_COUNTERS; ++index)
+        {
+            if (stats->files[index] == -1) printf(",\"%s\":null", counter_names[index]);
+            else printf(",\"%s\":%" PRIu64, counter_names[index], stats->counts[phase][index]);
+        }
+
+        printf("}");
+    }
+
+    printf("}\n");
+}
@@ -0,0 +1,44 @@
+#ifndef COMMON_STATS_H
+#define COMMON_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum stats_phase
+{
+    stats_read = 0,
+    stats_parse = 1,
+    stats_solve = 2,
+};
+
+enum stats_counter
+{
+    stats_cycles = 0,
+    stats_instructions = 1,
+    stats_cache_misses = 2,
+    stats_branch_misses = 3,
+};
+
+#define STATS_PHASES 3
+#define STATS_COUNTERS 4
+
+struct stats
+{
+    int files[STATS_COUNTERS];
+
+    uint64_t start_ns;
+    uint64_t start_counts[STATS_COUNTERS];
+
+    uint64_t elapsed_ns[STATS_PHASES];
+    uint64_t counts[STATS_PHASES][STATS_COUNTERS];
+};
+
+void stats_init(struct stats* stats);
+void stats_free(struct stats* stats);
+
+void stats_begin(struct stats* stats);
+void stats_end(struct stats* stats, enum stats_phase phase);
+
+void stats_print(const struct stats* stats, int challenge);
+
+#endif
@@ -0,0 +1,271 @@
+#define _GNU_SOURCE
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "input.h"
+#include "buffer.h"
+#include "stream.h"
+
+#define STREAM_SLOT_SIZE (STREAM_CARRY_SIZE + STREAM_BUFFER_SIZE + INPUT_PADDING)
+
+struct stream_slot
+{
+    char* data;
+    size_t length;
+
+    int full;
+    int final;
+    int error;
+};
+
+struct stream
+{
+    int file;
+    int stopped;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t condition;
+
+    struct stream_slot slots[2];
+};
+
+int stream_wanted(const char* name)
+{
+    if (strcmp(name, "-") == 0) return 1;
+
+    struct stat64 stat;
+    if (stat64(name, &stat) == -1) return 0;
+
+    return !S_ISREG(stat.st_mode);
+}
+
+int stream_open(const char* name)
+{
+    if (strcmp(name, "-") == 0) return STDIN_FILENO;
+    return open(name, O_RDONLY);
+}
+
+void stream_close(int file)
+{
+    if (file != -1 && file != STDIN_FILENO) close(file);
+}
+
+static void* stream_reader(void* argument)
+{
+    struct stream* stream = argument;
+
+    int state;
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state);
+
+    for (size_t slot_index = 0;; slot_index ^= 1)
+    {
+        struct stream_slot* slot = &stream->slots[slot_index];
+
+        pthread_mutex_lock(&stream->mutex);
+        while (slot->full && !stream->stopped) pthread_cond_wait(&stream->condition, &stream->mutex);
+
+        int stopped = stream->stopped;
+        pthread_mutex_unlock(&stream->mutex);
+
+        if (stopped) break;
+
+        char* base = slot->data + STREAM_CARRY_SIZE;
+
+        size_t length = 0;
+        int final = 0;
+        int error = 0;
+
+        while (length < STREAM_BUFFER_SIZE)
+        {
+            pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, &state);
+            ssize_t chars = read(stream->file, base + length, STREAM_BUFFER_SIZE - length);
+            pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state);
+
+            if (chars == -1 && errno == EINTR) continue;
+
+            if (chars == -1) error = errno;
+            if (chars <= 0) final = 1;
+            if (chars <= 0) break;
+
+            length += chars;
+        }
+
+        pthread_mutex_lock(&stream->mutex);
+
+        slot->length = length;
+        slot->final = final;
+        slot->error = error;
+        slot->full = 1;
+
+        pthread_cond_broadcast(&stream->condition);
+        pthread_mutex_unlock(&stream->mutex);
+
+        if (final) break;
+    }
+
+    return NULL;
+}
+
+int stream_run(int file, stream_consume consume, void* context)
+{
+    int result = -1;
+    int error = 0;
+    int started = 0;
+
+    char* carry = NULL;
+    size_t carry_length = 0;
+
+    pthread_t reader;
+
+    struct stream stream;
+    memset(&stream, 0, sizeof(struct stream));
+
+    stream.file = file;
+
+    pthread_mutex_init(&stream.mutex, NULL);
+    pthread_cond_init(&stream.condition, NULL);
+
+    carry = malloc(STREAM_CARRY_SIZE);
+    if (carry == NULL) goto cleanup;
+
+    for (size_t slot_index = 0; slot_index < 2; ++slot_index)
+    {
+        stream.slots[slot_index].data = malloc(STREAM_SLOT_SIZE);
+        if (stream.slots[slot_index].data == NULL) goto cleanup;
+    }
+
+    error = pthread_create(&reader, NULL, stream_reader, &stream);
+
+    if (error != 0)
+    {
+        errno = error;
+        goto cleanup;
+    }
+
+    started = 1;
+
+    for (size_t slot_index = 0;; slot_index ^= 1)
+    {
+        struct stream_slot* slot = &stream.slots[slot_index];
+
+        pthread_mutex_lock(&stream.mutex);
+        while (!slot->full) pthread_cond_wait(&stream.condition, &stream.mutex);
+        pthread_mutex_unlock(&stream.mutex);
+
+        if (slot->error != 0)
+        {
+            errno = slot->error;
+            goto cleanup;
+        }
+
+        char* base = slot->data + STREAM_CARRY_SIZE;
+
+        char* str = base - carry_length;
+        char* last = base + slot->length;
+
+        memcpy(str, carry, carry_length);
+        memset(last, 0, INPUT_PADDING);
+
+        int final = slot->final;
+
+        const char* end = consume(str, last, final, context);
+        if (end == NULL) goto cleanup;
+
+        carry_length = last - end;
+
+        if (carry_length > STREAM_CARRY_SIZE)
+        {
+            errno = EOVERFLOW;
+            goto cleanup;
+        }
+
+        memcpy(carry, end, carry_length);
+
+        pthread_mutex_lock(&stream.mutex);
+
+        slot->full = 0;
+
+        pthread_cond_broadcast(&stream.condition);
+        pthread_mutex_unlock(&stream.mutex);
+
+        if (final) break;
+    }
+
+    result = 0;
+
+    cleanup: error = errno;
+
+    if (started)
+    {
+        pthread_mutex_lock(&stream.mutex);
+
+        stream.stopped = 1;
+
+        pthread_cond_broadcast(&stream.condition);
+        pthread_mutex_unlock(&stream.mutex);
+
+        if (result == -1) pthread_cancel(reader);
+        pthread_join(reader, NULL);
+    }
+
+    for (size_t slot_index = 0; slot_index < 2; ++slot_index)
+    {
+        if (stream.slots[slot_index].data != NULL) free(stream.slots[slot_index].data);
+    }
+
+    if (carry != NULL) free(carry);
+
+    pthread_mutex_destroy(&stream.mutex);
+    pthread_cond_destroy(&stream.condition);
+
+    errno = error;
+
+    return result;
+}
+
+const char* stream_split(const char* str, const char* last, int separator)
+{
+    const char* found = memrchr(str, separator, last - str);
+    if (found == NULL) return str;
+
+    return found + 1;
+}
+
+int stream_slurp(const char* name, struct buffer* buffer)
+{
+    int file = stream_open(name);
+    if (file == -1) return -1;
+
+    int result = -1;
+
+    while (1)
+    {
+        if (buffer->capacity - buffer->length < INPUT_PADDING + 1 && buffer_grow(buffer) == -1) goto cleanup;
+
+        char* base = (char*) buffer->data + buffer->length;
+        ssize_t chars = read(file, base, buffer->capacity - buffer->length - INPUT_PADDING);
+
+        if (chars == -1 && errno == EINTR) continue;
+        if (chars == -1) goto cleanup;
+        if (chars == 0) break;
+
+        buffer->length += chars;
+    }
+
+    memset((char*) buffer->data + buffer->length, 0, INPUT_PADDING);
+    result = 0;
+
+    cleanup: stream_close(file);
+
+    return result;
+}
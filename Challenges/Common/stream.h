@@ -0,0 +1,26 @@
+#ifndef COMMON_STREAM_H
+#define COMMON_STREAM_H
+
+#include <stddef.h>
+
+#include "buffer.h"
+
+#ifndef STREAM_BUFFER_SIZE
+#define STREAM_BUFFER_SIZE (1 << 22)
+#endif
+
+#ifndef STREAM_CARRY_SIZE
+#define STREAM_CARRY_SIZE (1 << 16)
+#endif
+
+typedef const char* (*stream_consume)(const char* str, const char* last, int final, void* context);
+
+int stream_wanted(const char* name);
+int stream_open(const char* name);
+void stream_close(int file);
+
+int stream_run(int file, stream_consume consume, void* context);
+const char* stream_split(const char* str, const char* last, int separator);
+int stream_slurp(const char* name, struct buffer* buffer);
+
+#endif
@@ -0,0 +1,376 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <pthread.h>
+
+#include <unistd.h>
+
+#include "../../Challenges/Common/input.h"
+#include "../../Challenges/Common/buffer.h"
+#include "../../Challenges/Common/stream.h"
+#include "../../Challenges/Common/solver.h"
+
+#include "../Common/solvers.h"
+
+struct job
+{
+    uint64_t challenge;
+    const char* path;
+    size_t hints[SOLVER_MAX_HINTS];
+
+    int done;
+    int error;
+    struct solver_answers answers;
+};
+
+struct worker
+{
+    struct pool* pool;
+    size_t id;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+
+    size_t next;
+    size_t end;
+
+    void* workspaces[TOTAL_SOLVERS];
+};
+
+struct pool
+{
+    struct job* jobs;
+    size_t total_jobs;
+
+    struct worker* workers;
+    size_t total_workers;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t condition;
+};
+
+static int is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+static char* next_token(char** str, char* last)
+{
+    char* a = *str;
+
+    while (a != last && is_blank(*a)) ++a;
+    if (a == last) return NULL;
+
+    char* b = a;
+    while (b != last && !is_blank(*b)) ++b;
+
+    *str = b == last ? b : b + 1;
+    *b = '\0';
+
+    return a;
+}
+
+static int read_manifest(char* str, char* last, struct buffer* jobs)
+{
+    while (str < last)
+    {
+        char* line_end = memchr(str, '\n', last - str);
+        if (line_end == NULL) line_end = last;
+
+        char* a = str;
+        str = line_end + 1;
+
+        *line_end = '\0';
+
+        char* challenge = next_token(&a, line_end);
+        if (challenge == NULL || challenge[0] == '#') continue;
+
+        char* path = next_token(&a, line_end);
+
+        if (path == NULL)
+        {
+            errno = EINVAL;
+            return -1;
+        }
+
+        struct job* job = buffer_push(jobs);
+        if (job == NULL) return -1;
+
+        memset(job, 0, sizeof(struct job));
+
+        job->challenge = strtoull(challenge, NULL, 10);
+        job->path = path;
+
+        for (size_t index = 0; index < SOLVER_MAX_HINTS; ++index)
+        {
+            char* hint = next_token(&a, line_end);
+            if (hint == NULL) break;
+
+            job->hints[index] = strtoull(hint, NULL, 10);
+        }
+    }
+
+    return 0;
+}
+
+static int worker_take(struct worker* worker, size_t* index)
+{
+    int taken = 0;
+
+    pthread_mutex_lock(&worker->mutex);
+
+    if (worker->next != worker->end)
+    {
+        *index = worker->next++;
+        taken = 1;
+    }
+
+    pthread_mutex_unlock(&worker->mutex);
+
+    return taken;
+}
+
+static int worker_steal(struct worker* worker, size_t* index)
+{
+    struct pool* pool = worker->pool;
+
+    for (size_t offset = 1; offset < pool->total_workers; ++offset)
+    {
+        struct worker* victim = &pool->workers[(worker->id + offset) % pool->total_workers];
+
+        pthread_mutex_lock(&victim->mutex);
+
+        size_t remaining = victim->end - victim->next;
+        size_t stolen = (remaining + 1) / 2;
+
+        victim->end -= stolen;
+        size_t begin = victim->end;
+
+        pthread_mutex_unlock(&victim->mutex);
+
+        if (stolen == 0) continue;
+
+        pthread_mutex_lock(&worker->mutex);
+
+        worker->next = begin + 1;
+        worker->end = begin + stolen;
+
+        pthread_mutex_unlock(&worker->mutex);
+
+        *index = begin;
+
+        return 1;
+    }
+
+    return 0;
+}
+
+static int run_job(struct worker* worker, struct job* job)
+{
+    const struct solver* solver = solvers_find(job->challenge);
+    if (solver == NULL) return -1;
+
+    void** workspace = &worker->workspaces[job->challenge - 1];
+
+    if (*workspace == NULL)
+    {
+        *workspace = malloc(solver->workspace_size);
+        if (*workspace == NULL) return -1;
+
+        solver->init(*workspace);
+    }
+
+    struct input input;
+    if (input_open(job->path, &input) == -1) return -1;
+
+    int result = solver->solve(&input, job->hints, *workspace, &job->answers);
+    input_close(&input);
+
+    return result;
+}
+
+static void* worker_main(void* argument)
+{
+    struct worker* worker = argument;
+    struct pool* pool = worker->pool;
+
+    size_t index;
+
+    while (worker_take(worker, &index) || worker_steal(worker, &index))
+    {
+        struct job* job = &pool->jobs[index];
+
+        int error = 0;
+        if (run_job(worker, job) == -1) error = errno;
+
+        pthread_mutex_lock(&pool->mutex);
+
+        job->error = error;
+        job->done = 1;
+
+        pthread_cond_broadcast(&pool->condition);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+
+    return NULL;
+}
+
+static void usage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [options] <manifest|->\n"
+        "  --threads N        worker threads (default: online cores)\n"
+        "\n"
+        "Each manifest line is '<challenge> <input> [hints...]', with the same hints as\n"
+        "the challenge programs. Blank lines and lines starting with '#' are skipped.\n",
+        name);
+}
+
+int main(int argc, char** argv)
+{
+    static const struct option long_options[] =
+    {
+        {"threads", required_argument, NULL, 't'},
+        {NULL, 0, NULL, 0},
+    };
+
+    long total_threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+    int option;
+
+    while ((option = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (option)
+        {
+            case 't': total_threads = strtol(optarg, NULL, 10); break;
+            default: usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+
+    if (argc - optind < 1)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (total_threads < 1) total_threads = 1;
+
+    int result = -1;
+    int failures = 0;
+    size_t started = 0;
+
+    struct buffer manifest;
+    struct buffer jobs;
+
+    buffer_init(&manifest, sizeof(char));
+    buffer_init(&jobs, sizeof(struct job));
+
+    struct pool pool;
+    memset(&pool, 0, sizeof(struct pool));
+
+    pthread_mutex_init(&pool.mutex, NULL);
+    pthread_cond_init(&pool.condition, NULL);
+
+    if (stream_slurp(argv[optind], &manifest) == -1)
+    {
+        perror("Failed to read manifest");
+        goto cleanup;
+    }
+
+    char* str = manifest.data;
+
+    if (read_manifest(str, str + manifest.length, &jobs) == -1)
+    {
+        perror("Failed to parse manifest");
+        goto cleanup;
+    }
+
+    pool.jobs = jobs.data;
+    pool.total_jobs = jobs.length;
+    pool.total_workers = total_threads;
+
+    pool.workers = calloc(pool.total_workers, sizeof(struct worker));
+    if (pool.workers == NULL) goto cleanup;
+
+    for (size_t id = 0; id < pool.total_workers; ++id)
+    {
+        struct worker* worker = &pool.workers[id];
+
+        worker->pool = &pool;
+        worker->id = id;
+        worker->next = pool.total_jobs * id / pool.total_workers;
+        worker->end = pool.total_jobs * (id + 1) / pool.total_workers;
+
+        pthread_mutex_init(&worker->mutex, NULL);
+    }
+
+    for (; started < pool.total_workers; ++started)
+    {
+        struct worker* worker = &pool.workers[started];
+        int error = pthread_create(&worker->thread, NULL, worker_main, worker);
+
+        if (error != 0)
+        {
+            errno = error;
+
+            perror("Failed to start worker");
+            goto cleanup;
+        }
+    }
+
+    for (size_t index = 0; index < pool.total_jobs; ++index)
+    {
+        struct job* job = &pool.jobs[index];
+
+        pthread_mutex_lock(&pool.mutex);
+        while (!job->done) pthread_cond_wait(&pool.condition, &pool.mutex);
+        pthread_mutex_unlock(&pool.mutex);
+
+        if (job->error != 0)
+        {
+            printf("%" PRIu64 " %s error %s\n", job->challenge, job->path, strerror(job->error));
+            failures += 1;
+        }
+        else
+        {
+            printf("%" PRIu64 " %s %s %s\n", job->challenge, job->path, job->answers.part_1, job->answers.part_2);
+        }
+    }
+
+    result = 0;
+
+    cleanup: for (size_t id = 0; id < started; ++id)
+    {
+        pthread_join(pool.workers[id].thread, NULL);
+    }
+
+    for (size_t id = 0; pool.workers != NULL && id < pool.total_workers; ++id)
+    {
+        struct worker* worker = &pool.workers[id];
+
+        for (size_t index = 0; index < TOTAL_SOLVERS; ++index)
+        {
+            if (worker->workspaces[index] == NULL) continue;
+
+            solvers[index]->free(worker->workspaces[index]);
+            free(worker->workspaces[index]);
+        }
+
+        pthread_mutex_destroy(&worker->mutex);
+    }
+
+    if (pool.workers != NULL) free(pool.workers);
+
+    pthread_mutex_destroy(&pool.mutex);
+    pthread_cond_destroy(&pool.condition);
+
+    buffer_free(&manifest);
+    buffer_free(&jobs);
+
+    return result == -1 || failures != 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
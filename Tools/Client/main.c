@@ -0,0 +1,139 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "../../Challenges/Common/buffer.h"
+#include "../../Challenges/Common/stream.h"
+#include "../../Challenges/Common/solver.h"
+
+#include "../Common/protocol.h"
+
+static int send_request(int file, const struct protocol_request* request, const char* path, const struct buffer* payload)
+{
+    if (protocol_write(file, request, sizeof(struct protocol_request)) == -1) return -1;
+    if (protocol_write(file, path, request->path_length) == -1) return -1;
+    if (protocol_write(file, payload->data, request->payload_length) == -1) return -1;
+
+    return 0;
+}
+
+static void usage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s <challenge> <input|-> [hints...]\n"
+        "\n"
+        "The daemon socket is taken from $" PROTOCOL_SOCKET_VARIABLE ", or " PROTOCOL_SOCKET " by default.\n",
+        name);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int file = -1;
+    int result = -1;
+
+    char path[PATH_MAX] = "";
+
+    struct buffer payload;
+    buffer_init(&payload, sizeof(char));
+
+    struct protocol_request request;
+    memset(&request, 0, sizeof(struct protocol_request));
+
+    request.challenge = strtoul(argv[1], NULL, 10);
+
+    size_t hints[SOLVER_MAX_HINTS];
+    solver_parse_hints(argc - 3, argv + 3, hints);
+
+    for (size_t index = 0; index < SOLVER_MAX_HINTS; ++index)
+    {
+        request.hints[index] = hints[index];
+    }
+
+    if (stream_wanted(argv[2]))
+    {
+        if (stream_slurp(argv[2], &payload) == -1)
+        {
+            perror("Failed to read input stream");
+            goto cleanup;
+        }
+
+        request.payload_length = payload.length;
+    }
+    else
+    {
+        if (realpath(argv[2], path) == NULL)
+        {
+            perror("Failed to read input file");
+            goto cleanup;
+        }
+
+        request.path_length = strlen(path);
+    }
+
+    struct sockaddr_un address;
+
+    if (protocol_address(NULL, &address) == -1)
+    {
+        perror("Failed to resolve socket path");
+        goto cleanup;
+    }
+
+    file = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (file == -1 || connect(file, (struct sockaddr*) &address, sizeof(struct sockaddr_un)) == -1)
+    {
+        perror("Failed to connect to daemon");
+        goto cleanup;
+    }
+
+    if (send_request(file, &request, path, &payload) == -1)
+    {
+        perror("Failed to send request");
+        goto cleanup;
+    }
+
+    struct protocol_response response;
+
+    ssize_t chars = protocol_read(file, &response, sizeof(struct protocol_response));
+
+    if (chars != sizeof(struct protocol_response))
+    {
+        if (chars != -1) errno = ECONNRESET;
+
+        perror("Failed to receive response");
+        goto cleanup;
+    }
+
+    if (response.error != 0)
+    {
+        errno = response.error;
+
+        perror("Failed to solve input");
+        goto cleanup;
+    }
+
+    solver_print(&response.answers);
+
+    result = 0;
+
+    cleanup: if (file != -1) close(file);
+    buffer_free(&payload);
+
+    return result == -1 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "protocol.h"
+
+int protocol_address(const char* name, struct sockaddr_un* address)
+{
+    if (name == NULL) name = getenv(PROTOCOL_SOCKET_VARIABLE);
+    if (name == NULL) name = PROTOCOL_SOCKET;
+
+    memset(address, 0, sizeof(struct sockaddr_un));
+    address->sun_family = AF_UNIX;
+
+    size_t length = strlen(name);
+
+    if (length >= sizeof(address->sun_path))
+    {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+
+    memcpy(address->sun_path, name, length);
+
+    return 0;
+}
+
+ssize_t protocol_read(int file, void* data, size_t size)
+{
+    size_t length = 0;
+
+    while (length < size)
+    {
+        ssize_t chars = read(file, (char*) data + length, size - length);
+
+        if (chars == -1 && errno == EINTR) continue;
+        if (chars == -1) return -1;
+        if (chars == 0) break;
+
+        length += chars;
+    }
+
+    return length;
+}
+
+int protocol_write(int file, const void* data, size_t size)
+{
+    size_t length = 0;
+
+    while (length < size)
+    {
+        ssize_t chars = send(file, (const char*) data + length, size - length, MSG_NOSIGNAL);
+
+        if (chars == -1 && errno == EINTR) continue;
+        if (chars == -1) return -1;
+
+        length += chars;
+    }
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+#ifndef TOOLS_PROTOCOL_H
+#define TOOLS_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "../../Challenges/Common/solver.h"
+
+#define PROTOCOL_SOCKET "/tmp/advent-of-code.sock"
+#define PROTOCOL_SOCKET_VARIABLE "ADVENT_OF_CODE_SOCKET"
+
+#define PROTOCOL_MAX_PATH 4096
+#define PROTOCOL_MAX_PAYLOAD ((uint64_t) 1 << 32)
+#define PROTOCOL_TIMEOUT 10
+
+struct protocol_request
+{
+    uint32_t challenge;
+    uint32_t path_length;
+    uint64_t payload_length;
+    uint64_t hints[SOLVER_MAX_HINTS];
+};
+
+struct protocol_response
+{
+    int32_t error;
+    struct solver_answers answers;
+};
+
+int protocol_address(const char* name, struct sockaddr_un* address);
+ssize_t protocol_read(int file, void* data, size_t size);
+int protocol_write(int file, const void* data, size_t size);
+
+#endif
@@ -0,0 +1,31 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <errno.h>
+
+#include "../../Challenges/Challenge_1/challenge_1.h"
+#include "../../Challenges/Challenge_2/challenge_2.h"
+#include "../../Challenges/Challenge_3/challenge_3.h"
+#include "../../Challenges/Challenge_4/challenge_4.h"
+#include "../../Challenges/Challenge_5/challenge_5.h"
+
+#include "solvers.h"
+
+const struct solver* const solvers[TOTAL_SOLVERS] =
+{
+    &challenge_1_solver,
+    &challenge_2_solver,
+    &challenge_3_solver,
+    &challenge_4_solver,
+    &challenge_5_solver,
+};
+
+const struct solver* solvers_find(uint64_t challenge)
+{
+    if (challenge < 1 || challenge > TOTAL_SOLVERS)
+    {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    return solvers[challenge - 1];
+}
@@ -0,0 +1,15 @@
+#ifndef TOOLS_SOLVERS_H
+#define TOOLS_SOLVERS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../../Challenges/Common/solver.h"
+
+#define TOTAL_SOLVERS 5
+
+extern const struct solver* const solvers[TOTAL_SOLVERS];
+
+const struct solver* solvers_find(uint64_t challenge);
+
+#endif
@@ -0,0 +1,234 @@
+#define _GNU_SOURCE
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#include "../../Challenges/Common/input.h"
+#include "../../Challenges/Common/buffer.h"
+#include "../../Challenges/Common/solver.h"
+
+#include "../Common/protocol.h"
+#include "../Common/solvers.h"
+
+struct daemon
+{
+    void* workspaces[TOTAL_SOLVERS];
+
+    struct buffer path;
+    struct buffer payload;
+};
+
+static volatile sig_atomic_t stopped = 0;
+
+static void handle_signal(int number)
+{
+    (void) number;
+
+    stopped = 1;
+}
+
+static int receive(int file, struct buffer* buffer, size_t size, size_t padding)
+{
+    buffer_clear(buffer);
+    if (buffer_reserve(buffer, size + padding) == -1) return -1;
+
+    ssize_t chars = protocol_read(file, buffer->data, size);
+    if (chars == -1) return -1;
+
+    if ((size_t) chars != size)
+    {
+        errno = ECONNRESET;
+        return -1;
+    }
+
+    memset((char*) buffer->data + size, 0, padding);
+    buffer->length = size;
+
+    return 0;
+}
+
+static int receive_request(struct daemon* daemon, int file, const struct protocol_request* request)
+{
+    if (request->path_length > PROTOCOL_MAX_PATH || request->payload_length > PROTOCOL_MAX_PAYLOAD)
+    {
+        errno = EMSGSIZE;
+        return -1;
+    }
+
+    if (receive(file, &daemon->path, request->path_length, 1) == -1) return -1;
+    if (receive(file, &daemon->payload, request->payload_length, INPUT_PADDING) == -1) return -1;
+
+    return 0;
+}
+
+static int solve_request(struct daemon* daemon, const struct protocol_request* request, struct solver_answers* answers)
+{
+    const struct solver* solver = solvers_find(request->challenge);
+    if (solver == NULL) return -1;
+
+    size_t hints[SOLVER_MAX_HINTS];
+
+    for (size_t index = 0; index < SOLVER_MAX_HINTS; ++index)
+    {
+        hints[index] = request->hints[index];
+    }
+
+    void* workspace = daemon->workspaces[request->challenge - 1];
+
+    struct input input;
+    memset(&input, 0, sizeof(struct input));
+
+    if (request->path_length == 0)
+    {
+        input.begin = daemon->payload.data;
+        input.end = input.begin + daemon->payload.length;
+    }
+    else if (input_open(daemon->path.data, &input) == -1)
+    {
+        return -1;
+    }
+
+    int result = solver->solve(&input, hints, workspace, answers);
+    if (input.mapping != NULL) input_close(&input);
+
+    return result;
+}
+
+static void serve_connection(struct daemon* daemon, int file)
+{
+    struct timeval timeout = {PROTOCOL_TIMEOUT, 0};
+    setsockopt(file, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(struct timeval));
+
+    while (!stopped)
+    {
+        struct protocol_request request;
+
+        ssize_t chars = protocol_read(file, &request, sizeof(struct protocol_request));
+        if (chars != sizeof(struct protocol_request)) break;
+
+        struct protocol_response response;
+        memset(&response, 0, sizeof(struct protocol_response));
+
+        int result = receive_request(daemon, file, &request);
+
+        if (result == -1) response.error = errno;
+        else if (solve_request(daemon, &request, &response.answers) == -1) response.error = errno;
+
+        if (protocol_write(file, &response, sizeof(struct protocol_response)) == -1) break;
+        if (result == -1) break;
+    }
+
+    close(file);
+}
+
+int main(int argc, char** argv)
+{
+    int status = EXIT_FAILURE;
+
+    int listener = -1;
+    int bound = 0;
+
+    struct daemon daemon;
+    memset(&daemon, 0, sizeof(struct daemon));
+
+    buffer_init(&daemon.path, sizeof(char));
+    buffer_init(&daemon.payload, sizeof(char));
+
+    struct sockaddr_un address;
+
+    if (protocol_address(argc > 1 ? argv[1] : NULL, &address) == -1)
+    {
+        perror("Failed to resolve socket path");
+        return EXIT_FAILURE;
+    }
+
+    for (size_t index = 0; index < TOTAL_SOLVERS; ++index)
+    {
+        daemon.workspaces[index] = malloc(solvers[index]->workspace_size);
+        if (daemon.workspaces[index] == NULL) goto cleanup;
+
+        solvers[index]->init(daemon.workspaces[index]);
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(struct sigaction));
+
+    action.sa_handler = handle_signal;
+
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (listener == -1)
+    {
+        perror("Failed to create socket");
+        goto cleanup;
+    }
+
+    unlink(address.sun_path);
+
+    mode_t mask = umask(0077);
+    int result = bind(listener, (struct sockaddr*) &address, sizeof(struct sockaddr_un));
+    umask(mask);
+
+    if (result == -1)
+    {
+        perror("Failed to bind socket");
+        goto cleanup;
+    }
+
+    bound = 1;
+
+    if (listen(listener, SOMAXCONN) == -1)
+    {
+        perror("Failed to listen on socket");
+        goto cleanup;
+    }
+
+    status = EXIT_SUCCESS;
+
+    while (!stopped)
+    {
+        int file = accept4(listener, NULL, NULL, SOCK_CLOEXEC);
+
+        if (file == -1 && errno == EINTR) continue;
+
+        if (file == -1)
+        {
+            perror("Failed to accept connection");
+            break;
+        }
+
+        serve_connection(&daemon, file);
+    }
+
+    cleanup: if (listener != -1) close(listener);
+    if (bound) unlink(address.sun_path);
+
+    for (size_t index = 0; index < TOTAL_SOLVERS; ++index)
+    {
+        if (daemon.workspaces[index] == NULL) continue;
+
+        solvers[index]->free(daemon.workspaces[index]);
+        free(daemon.workspaces[index]);
+    }
+
+    buffer_free(&daemon.path);
+    buffer_free(&daemon.payload);
+
+    return status;
+}
@@ -0,0 +1,462 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "../../Challenges/Challenge_2/challenge_2.h"
+
+#define WRITER_CAPACITY (1 << 20)
+
+struct options
+{
+    uint64_t seed;
+    uint64_t bytes;
+
+    uint64_t max_value;
+    uint64_t step;
+
+    size_t columns;
+
+    size_t width;
+    size_t height;
+    size_t numbers;
+
+    size_t canvas_width;
+    size_t canvas_height;
+    size_t max_length;
+    double diagonal;
+};
+
+struct writer
+{
+    int file;
+
+    char* buffer;
+    size_t used;
+
+    uint64_t written;
+    uint64_t state;
+};
+
+static uint64_t random_next(uint64_t* state)
+{
+    uint64_t value = (*state += 0x9E3779B97F4A7C15);
+
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+
+    return value ^ (value >> 31);
+}
+
+static uint64_t random_below(uint64_t* state, uint64_t bound)
+{
+    return (uint64_t) (((unsigned __int128) random_next(state) * bound) >> 64);
+}
+
+static double random_unit(uint64_t* state)
+{
+    return (double) (random_next(state) >> 11) / (double) ((uint64_t) 1 << 53);
+}
+
+static int writer_flush(struct writer* writer)
+{
+    size_t index = 0;
+
+    while (index < writer->used)
+    {
+        ssize_t chars = write(writer->file, writer->buffer + index, writer->used - index);
+        if (chars == -1) return -1;
+
+        index += chars;
+    }
+
+    writer->written += writer->used;
+    writer->used = 0;
+
+    return 0;
+}
+
+static int writer_reserve(struct writer* writer, size_t size)
+{
+    if (writer->used + size <= WRITER_CAPACITY) return 0;
+    return writer_flush(writer);
+}
+
+static uint64_t writer_total(const struct writer* writer)
+{
+    return writer->written + writer->used;
+}
+
+static void emit_char(struct writer* writer, char c)
+{
+    writer->buffer[writer->used++] = c;
+}
+
+static void emit_string(struct writer* writer, const char* str)
+{
+    size_t length = strlen(str);
+
+    memcpy(writer->buffer + writer->used, str, length);
+    writer->used += length;
+}
+
+static void emit_decimal(struct writer* writer, uint64_t value, size_t min_digits, char pad, uint64_t base)
+{
+    char digits[64];
+    size_t length = 0;
+
+    do
+    {
+        digits[length++] = '0' + value % base;
+        value /= base;
+    }
+    while (value != 0);
+
+    while (length < min_digits) digits[length++] = pad;
+    while (length != 0) emit_char(writer, digits[--length]);
+}
+
+static size_t count_digits(uint64_t value)
+{
+    size_t digits = 1;
+
+    while (value >= 10)
+    {
+        value /= 10;
+        digits += 1;
+    }
+
+    return digits;
+}
+
+static int generate_1(struct writer* writer, const struct options* options)
+{
+    uint64_t max_value = options->max_value != 0 ? options->max_value : 10000;
+    uint64_t depth = max_value / 2;
+
+    while (writer_total(writer) < options->bytes)
+    {
+        if (writer_reserve(writer, 32) == -1) return -1;
+
+        if (options->step == 0)
+        {
+            depth = max_value == UINT64_MAX ? random_next(&writer->state) : random_below(&writer->state, max_value + 1);
+        }
+        else
+        {
+            uint64_t offset = random_below(&writer->state, 2 * options->step + 1);
+
+            if (offset > options->step && offset - options->step <= max_value - depth) depth += offset - options->step;
+            if (offset < options->step && depth >= options->step - offset) depth -= options->step - offset;
+        }
+
+        emit_decimal(writer, depth, 1, '0', 10);
+        emit_char(writer, '\n');
+    }
+
+    return 0;
+}
+
+static int generate_2(struct writer* writer, const struct options* options)
+{
+    static const char* keywords[] = {"forward ", "up ", "down "};
+    uint64_t max_value = options->max_value != 0 ? options->max_value : 9;
+    if (max_value > MOVEMENT_MAX_VALUE) max_value = MOVEMENT_MAX_VALUE;
+
+    while (writer_total(writer) < options->bytes)
+    {
+        if (writer_reserve(writer, 32) == -1) return -1;
+
+        emit_string(writer, keywords[random_below(&writer->state, 3)]);
+        emit_decimal(writer, 1 + random_below(&writer->state, max_value), 1, '0', 10);
+        emit_char(writer, '\n');
+    }
+
+    return 0;
+}
+
+static int generate_3(struct writer* writer, const struct options* options)
+{
+    size_t columns = options->columns != 0 ? options->columns : 12;
+
+    while (writer_total(writer) < options->bytes)
+    {
+        for (size_t remaining = columns; remaining != 0;)
+        {
+            if (writer_reserve(writer, 80) == -1) return -1;
+
+            size_t chunk = (remaining - 1) % 64 + 1;
+
+            uint64_t row = random_next(&writer->state);
+            if (chunk < 64) row &= ((uint64_t) 1 << chunk) - 1;
+
+            emit_decimal(writer, row, chunk, '0', 2);
+            remaining -= chunk;
+        }
+
+        emit_char(writer, '\n');
+    }
+
+    return 0;
+}
+
+static int generate_4(struct writer* writer, const struct options* options)
+{
+    int result = -1;
+
+    size_t width = options->width != 0 ? options->width : 5;
+    size_t height = options->height != 0 ? options->height : 5;
+    size_t board_size = width * height;
+
+    size_t numbers = options->numbers != 0 ? options->numbers : 100;
+    if (numbers < board_size) numbers = board_size;
+
+    size_t pad = count_digits(numbers - 1);
+
+    uint64_t* pool = malloc(numbers * sizeof(uint64_t));
+    if (pool == NULL) goto cleanup;
+
+    for (size_t index = 0; index < numbers; ++index) pool[index] = index;
+
+    for (size_t index = numbers - 1; index > 0; --index)
+    {
+        size_t other = random_below(&writer->state, index + 1);
+
+        uint64_t temp = pool[index];
+        pool[index] = pool[other];
+        pool[other] = temp;
+    }
+
+    for (size_t index = 0; index < numbers; ++index)
+    {
+        if (writer_reserve(writer, 32) == -1) goto cleanup;
+
+        if (index != 0) emit_char(writer, ',');
+        emit_decimal(writer, pool[index], 1, '0', 10);
+    }
+
+    if (writer_reserve(writer, 1) == -1) goto cleanup;
+    emit_char(writer, '\n');
+
+    while (writer_total(writer) < options->bytes)
+    {
+        if (writer_reserve(writer, 1) == -1) goto cleanup;
+        emit_char(writer, '\n');
+
+        for (size_t index = 0; index < board_size; ++index)
+        {
+            size_t other = index + random_below(&writer->state, numbers - index);
+
+            uint64_t temp = pool[index];
+            pool[index] = pool[other];
+            pool[other] = temp;
+
+            if (writer_reserve(writer, 32) == -1) goto cleanup;
+
+            if (index % width != 0) emit_char(writer, ' ');
+            emit_decimal(writer, pool[index], pad, ' ', 10);
+            if (index % width == width - 1) emit_char(writer, '\n');
+        }
+    }
+
+    result = 0;
+
+    cleanup: if (pool != NULL) free(pool);
+
+    return result;
+}
+
+static int generate_5(struct writer* writer, const struct options* options)
+{
+    size_t canvas_width = options->canvas_width != 0 ? options->canvas_width : 1000;
+    size_t canvas_height = options->canvas_height != 0 ? options->canvas_height : 1000;
+
+    size_t max_length = options->max_length != 0 ? options->max_length : canvas_width + canvas_height;
+
+    while (writer_total(writer) < options->bytes)
+    {
+        if (writer_reserve(writer, 96) == -1) return -1;
+
+        uint64_t x1 = random_below(&writer->state, canvas_width);
+        uint64_t y1 = random_below(&writer->state, canvas_height);
+
+        uint64_t x2 = x1;
+        uint64_t y2 = y1;
+
+        if (random_unit(&writer->state) < options->diagonal)
+        {
+            uint64_t length = random_below(&writer->state, max_length + 1);
+
+            int left = random_below(&writer->state, 2);
+            int up = random_below(&writer->state, 2);
+
+            uint64_t room_x = left ? x1 : canvas_width - 1 - x1;
+            uint64_t room_y = up ? y1 : canvas_height - 1 - y1;
+
+            if (length > room_x) length = room_x;
+            if (length > room_y) length = room_y;
+
+            x2 = left ? x1 - length : x1 + length;
+            y2 = up ? y1 - length : y1 + length;
+        }
+        else
+        {
+            int vertical = random_below(&writer->state, 2);
+
+            size_t size = vertical ? canvas_height : canvas_width;
+            uint64_t start = vertical ? y1 : x1;
+
+            uint64_t low = start > max_length ? start - max_length : 0;
+            uint64_t high = start + max_length < size ? start + max_length : size - 1;
+
+            uint64_t other = low + random_below(&writer->state, high - low + 1);
+
+            if (vertical) y2 = other;
+            else x2 = other;
+        }
+
+        emit_decimal(writer, x1, 1, '0', 10);
+        emit_char(writer, ',');
+        emit_decimal(writer, y1, 1, '0', 10);
+        emit_string(writer, " -> ");
+        emit_decimal(writer, x2, 1, '0', 10);
+        emit_char(writer, ',');
+        emit_decimal(writer, y2, 1, '0', 10);
+        emit_char(writer, '\n');
+    }
+
+    return 0;
+}
+
+static uint64_t parse_size(const char* str)
+{
+    char* end;
+    uint64_t value = strtoull(str, &end, 10);
+
+    switch (*end)
+    {
+        case 'k': case 'K': value <<= 10; break;
+        case 'm': case 'M': value <<= 20; break;
+        case 'g': case 'G': value <<= 30; break;
+        case 't': case 'T': value <<= 40; break;
+    }
+
+    return value;
+}
+
+static void usage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s <challenge> <output|-> <size[K|M|G]> [options]\n"
+        "  --seed N           random seed (default 1)\n"
+        "  --max-value N      largest depth (1) or movement value (2)\n"
+        "  --step N           depth random walk step, 0 for uniform values (1)\n"
+        "  --columns N        bits per row (3)\n"
+        "  --width N          board width (4)\n"
+        "  --height N         board height (4)\n"
+        "  --numbers N        size of the drawn number range (4)\n"
+        "  --canvas-width N   canvas width (5)\n"
+        "  --canvas-height N  canvas height (5)\n"
+        "  --max-length N     longest segment (5)\n"
+        "  --diagonal F       fraction of diagonal segments (5)\n",
+        name);
+}
+
+int main(int argc, char** argv)
+{
+    static const struct option long_options[] =
+    {
+        {"seed", required_argument, NULL, 's'},
+        {"max-value", required_argument, NULL, 'v'},
+        {"step", required_argument, NULL, 'p'},
+        {"columns", required_argument, NULL, 'c'},
+        {"width", required_argument, NULL, 'w'},
+        {"height", required_argument, NULL, 'h'},
+        {"numbers", required_argument, NULL, 'n'},
+        {"canvas-width", required_argument, NULL, 'W'},
+        {"canvas-height", required_argument, NULL, 'H'},
+        {"max-length", required_argument, NULL, 'l'},
+        {"diagonal", required_argument, NULL, 'd'},
+        {NULL, 0, NULL, 0},
+    };
+
+    struct options options;
+    memset(&options, 0, sizeof(struct options));
+
+    options.seed = 1;
+    options.step = 8;
+    options.diagonal = 0.25;
+
+    int option;
+
+    while ((option = getopt_long(argc, argv, "", long_options, NULL)) != -1)
+    {
+        switch (option)
+        {
+            case 's': options.seed = strtoull(optarg, NULL, 10); break;
+            case 'v': options.max_value = strtoull(optarg, NULL, 10); break;
+            case 'p': options.step = strtoull(optarg, NULL, 10); break;
+            case 'c': options.columns = strtoull(optarg, NULL, 10); break;
+            case 'w': options.width = strtoull(optarg, NULL, 10); break;
+            case 'h': options.height = strtoull(optarg, NULL, 10); break;
+            case 'n': options.numbers = strtoull(optarg, NULL, 10); break;
+            case 'W': options.canvas_width = strtoull(optarg, NULL, 10); break;
+            case 'H': options.canvas_height = strtoull(optarg, NULL, 10); break;
+            case 'l': options.max_length = strtoull(optarg, NULL, 10); break;
+            case 'd': options.diagonal = strtod(optarg, NULL); break;
+            default: usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+
+    if (argc - optind < 3)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int challenge = atoi(argv[optind]);
+    const char* name = argv[optind + 1];
+
+    options.bytes = parse_size(argv[optind + 2]);
+
+    int (*generators[])(struct writer*, const struct options*) = {NULL, generate_1, generate_2, generate_3, generate_4, generate_5};
+
+    if (challenge < 1 || challenge > 5)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    struct writer writer;
+    memset(&writer, 0, sizeof(struct writer));
+
+    writer.state = options.seed;
+    writer.file = STDOUT_FILENO;
+
+    if (strcmp(name, "-") != 0) writer.file = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (writer.file == -1)
+    {
+        perror("Failed to open output file");
+        return EXIT_FAILURE;
+    }
+
+    writer.buffer = malloc(WRITER_CAPACITY);
+    if (writer.buffer == NULL) return EXIT_FAILURE;
+
+    int result = generators[challenge](&writer, &options);
+    if (result == 0) result = writer_flush(&writer);
+
+    if (result == -1) perror("Failed to write output");
+
+    if (writer.file != STDOUT_FILENO) close(writer.file);
+    free(writer.buffer);
+
+    return result == -1 ? EXIT_FAILURE : EXIT_SUCCESS;
+}